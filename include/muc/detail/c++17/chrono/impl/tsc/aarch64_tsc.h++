@@ -0,0 +1,67 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/common/inline_macro.h++"
+
+#include <cstdint>
+
+namespace muc::chrono::impl {
+
+/// @brief AArch64 generic timer virtual count (CNTVCT_EL0)
+class tsc {
+public:
+    /// @brief The generic timer always counts at a constant rate
+    static auto invariant() noexcept -> bool {
+        return true;
+    }
+
+    /// @brief Frequency in Hz from CNTFRQ_EL0, 0 if not set by firmware
+    static auto frequency() noexcept -> double {
+        std::uint64_t f;
+        asm volatile("mrs %0, cntfrq_el0" : "=r"(f));
+        return static_cast<double>(f);
+    }
+
+    MUC_ALWAYS_INLINE static auto read() noexcept -> std::uint64_t {
+        std::uint64_t t;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(t));
+        return t;
+    }
+
+    /// @brief Reads the counter after all preceding instructions have
+    /// completed and before any following instruction starts.
+    MUC_ALWAYS_INLINE static auto read_begin() noexcept -> std::uint64_t {
+        std::uint64_t t;
+        asm volatile("isb\n\tmrs %0, cntvct_el0\n\tisb" : "=r"(t) : : "memory");
+        return t;
+    }
+
+    /// @brief Reads the counter after all preceding instructions have
+    /// completed and before any following instruction starts.
+    MUC_ALWAYS_INLINE static auto read_end() noexcept -> std::uint64_t {
+        return read_begin();
+    }
+};
+
+} // namespace muc::chrono::impl
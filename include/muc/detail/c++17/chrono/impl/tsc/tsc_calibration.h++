@@ -0,0 +1,140 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// x86 implementation:
+#if defined __i386__ or defined __x86_64__ or defined _M_IX86 or \
+    (defined _M_X64 and not defined _M_ARM64EC)
+#include "muc/detail/c++17/chrono/impl/tsc/x86_tsc.h++"
+// AArch64 implementation:
+#elif defined __aarch64__ and (defined __GNUC__ or defined __clang__)
+#include "muc/detail/c++17/chrono/impl/tsc/aarch64_tsc.h++"
+// Fallback implementation:
+#else
+#include "muc/detail/c++17/chrono/impl/tsc/fallback_tsc.h++"
+#endif
+
+#include "muc/detail/c++17/chrono/steady_high_resolution_clock.h++"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace muc::chrono::impl {
+
+/// @brief Conversion from time-stamp counter ticks to nanoseconds.
+/// @details Measured once, on first use: if the counter is invariant and its
+/// frequency is not reported by the hardware, the counter is compared with
+/// `steady_high_resolution_clock` (CLOCK_MONOTONIC on Linux) over 10 ms.
+class tsc_calibration {
+public:
+    static auto get() noexcept -> const tsc_calibration& {
+        static const tsc_calibration calibration;
+        return calibration;
+    }
+
+    /// @brief Whether the counter is invariant and can be used
+    auto available() const noexcept -> bool {
+        return m_ns_per_tick > 0;
+    }
+
+    /// @brief Nanoseconds per tick, 0 if not available
+    auto ns_per_tick() const noexcept -> double {
+        return m_ns_per_tick;
+    }
+
+    /// @brief Relative uncertainty of `ns_per_tick()`
+    auto relative_error() const noexcept -> double {
+        return m_relative_error;
+    }
+
+    /// @brief Converts a tick count to nanoseconds in the epoch of
+    /// `steady_high_resolution_clock`
+    auto to_ns(std::uint64_t ticks) const noexcept -> std::int64_t {
+        const auto elapsed{static_cast<std::int64_t>(ticks - m_tick0)};
+        return m_ns0 + std::llround(elapsed * m_ns_per_tick);
+    }
+
+private:
+    tsc_calibration() noexcept :
+        m_ns_per_tick{},
+        m_relative_error{},
+        m_tick0{},
+        m_ns0{} {
+        if (not tsc::invariant()) {
+            return;
+        }
+
+        const auto s0{sample()};
+        m_tick0 = s0.tick;
+        m_ns0 = s0.ns;
+
+        if (const auto frequency{tsc::frequency()}; frequency > 0) {
+            m_ns_per_tick = 1e9 / frequency;
+            return;
+        }
+
+        constexpr std::int64_t calibration_time{10'000'000};
+        auto s1{sample()};
+        while (s1.ns - s0.ns < calibration_time) {
+            s1 = sample();
+        }
+        const auto ticks{static_cast<double>(s1.tick - s0.tick)};
+        m_ns_per_tick = (s1.ns - s0.ns) / ticks;
+        m_relative_error = (s0.uncertainty + s1.uncertainty) / 2 / ticks;
+    }
+
+    struct tick_ns_pair {
+        std::uint64_t tick;
+        std::int64_t ns;
+        double uncertainty; ///< in ticks
+    };
+
+    /// @brief A clock reading bracketed by two counter reads, the tightest of
+    /// a few tries
+    static auto sample() noexcept -> tick_ns_pair {
+        tick_ns_pair best{0, 0, std::numeric_limits<double>::infinity()};
+        for (int i{}; i < 5; ++i) {
+            const auto t0{tsc::read_begin()};
+            const auto ns{std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              steady_high_resolution_clock::now()
+                                  .time_since_epoch())
+                              .count()};
+            const auto t1{tsc::read_end()};
+            if (const auto width{static_cast<double>(t1 - t0)};
+                width < best.uncertainty) {
+                best = {t0 + (t1 - t0) / 2, ns, width};
+            }
+        }
+        return best;
+    }
+
+private:
+    double m_ns_per_tick;
+    double m_relative_error;
+    std::uint64_t m_tick0;
+    std::int64_t m_ns0;
+};
+
+} // namespace muc::chrono::impl
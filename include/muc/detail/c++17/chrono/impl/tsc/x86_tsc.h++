@@ -0,0 +1,103 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/common/inline_macro.h++"
+
+#if defined _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#include <cstdint>
+
+namespace muc::chrono::impl {
+
+/// @brief x86 time-stamp counter (RDTSC/RDTSCP)
+class tsc {
+public:
+    /// @brief Whether the TSC ticks at a constant rate in all power states
+    /// (CPUID.80000007H:EDX[8]) and RDTSCP is supported
+    /// (CPUID.80000001H:EDX[27]).
+    static auto invariant() noexcept -> bool {
+        if (cpuid(0x8000'0000).eax < 0x8000'0007) {
+            return false;
+        }
+        return (cpuid(0x8000'0007).edx >> 8 & 1) and
+               (cpuid(0x8000'0001).edx >> 27 & 1);
+    }
+
+    /// @brief Nominal frequency in Hz, 0 if unknown and to be calibrated
+    static auto frequency() noexcept -> double {
+        return 0;
+    }
+
+    MUC_ALWAYS_INLINE static auto read() noexcept -> std::uint64_t {
+        return __rdtsc();
+    }
+
+    /// @brief Reads the TSC after all preceding instructions have completed
+    /// and before any following instruction starts.
+    MUC_ALWAYS_INLINE static auto read_begin() noexcept -> std::uint64_t {
+        _mm_lfence();
+        const auto t{__rdtsc()};
+        _mm_lfence();
+        return t;
+    }
+
+    /// @brief Reads the TSC after all preceding instructions have completed
+    /// (RDTSCP), and before any following instruction starts.
+    MUC_ALWAYS_INLINE static auto read_end() noexcept -> std::uint64_t {
+        unsigned int aux;
+        const auto t{__rdtscp(&aux)};
+        _mm_lfence();
+        return t;
+    }
+
+private:
+    struct cpuid_result {
+        std::uint32_t eax;
+        std::uint32_t ebx;
+        std::uint32_t ecx;
+        std::uint32_t edx;
+    };
+
+    static auto cpuid(std::uint32_t leaf) noexcept -> cpuid_result {
+#if defined _MSC_VER
+        int r[4]{};
+        __cpuid(r, static_cast<int>(leaf));
+        return {static_cast<std::uint32_t>(r[0]),
+                static_cast<std::uint32_t>(r[1]),
+                static_cast<std::uint32_t>(r[2]),
+                static_cast<std::uint32_t>(r[3])};
+#else
+        unsigned int eax{}, ebx{}, ecx{}, edx{};
+        __cpuid(leaf, eax, ebx, ecx, edx);
+        return {eax, ebx, ecx, edx};
+#endif
+    }
+};
+
+} // namespace muc::chrono::impl
@@ -0,0 +1,62 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/c++17/chrono/impl/tsc/tsc_calibration.h++"
+#include "muc/detail/c++17/chrono/steady_high_resolution_clock.h++"
+
+#include <chrono>
+
+namespace muc::chrono {
+
+/// @brief Steady clock reading the CPU time-stamp counter (RDTSC on x86,
+/// CNTVCT_EL0 on AArch64), in the epoch of `steady_high_resolution_clock`.
+/// @details Falls back to `steady_high_resolution_clock` if the counter is not
+/// invariant. The conversion to nanoseconds is calibrated on first use, see
+/// `impl::tsc_calibration`.
+class tsc_clock {
+public:
+    using rep = std::chrono::nanoseconds::rep;
+    using period = std::chrono::nanoseconds::period;
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<tsc_clock>;
+
+    static constexpr bool is_steady{true};
+
+public:
+    static auto now() noexcept -> time_point {
+        const auto& calibration{impl::tsc_calibration::get()};
+        if (calibration.available()) {
+            return time_point{duration{calibration.to_ns(impl::tsc::read())}};
+        }
+        return time_point{std::chrono::duration_cast<duration>(
+            steady_high_resolution_clock::now().time_since_epoch())};
+    }
+
+    /// @brief Whether `now()` reads the time-stamp counter
+    static auto uses_tsc() noexcept -> bool {
+        return impl::tsc_calibration::get().available();
+    }
+};
+
+} // namespace muc::chrono
@@ -23,7 +23,7 @@
 #pragma once
 
 #include "muc/detail/c++17/memory/allocator_delete.h++"
-#include "muc/detail/c++17/type_traits/type_identity.h++"
+#include "muc/detail/c++17/type_traits/is_template_of.h++"
 
 #include <functional>
 #include <memory>
@@ -32,6 +32,24 @@
 
 namespace muc {
 
+namespace impl {
+
+// Specialized rather than std::conditional_t, so that allocator_traits is not
+// instantiated with a reference
+template<typename T, typename Alloc>
+struct unique_alloc_ptr {
+    using type = std::unique_ptr<
+        T, muc::allocator_delete<T, typename std::allocator_traits<
+                                        Alloc>::template rebind_alloc<T>>>;
+};
+
+template<typename T, typename Alloc>
+struct unique_alloc_ptr<T, Alloc&> {
+    using type = std::unique_ptr<T, muc::allocator_delete<T, Alloc&>>;
+};
+
+} // namespace impl
+
 /// @brief Determines the return type of allocate_unique.
 ///
 /// When Alloc is a reference type, the unique_ptr uses
@@ -42,12 +60,7 @@ namespace muc {
 /// @tparam T The type of the object to manage
 /// @tparam Alloc The allocator type (may be a reference)
 template<typename T, typename Alloc>
-using unique_alloc_ptr = std::conditional_t<
-    std::is_reference_v<Alloc>,
-    muc::type_identity_t<std::unique_ptr<T, muc::allocator_delete<T, Alloc>>>,
-    muc::type_identity_t<std::unique_ptr<
-        T, muc::allocator_delete<T, typename std::allocator_traits<
-                                        Alloc>::template rebind_alloc<T>>>>>;
+using unique_alloc_ptr = typename impl::unique_alloc_ptr<T, Alloc>::type;
 
 /// @brief Allocates and constructs an object of type T using an allocator,
 /// returning it in a std::unique_ptr.
@@ -67,11 +80,14 @@ using unique_alloc_ptr = std::conditional_t<
 /// The deleter type is determined by muc::unique_alloc_ptr<T, Alloc>
 ///
 /// @see muc::unique_alloc_ptr
-template<typename T, typename Alloc, typename... Args>
+template<typename T, typename Alloc, typename... Args,
+         std::enable_if_t<not muc::is_template_of_v<std::reference_wrapper,
+                                                    std::decay_t<Alloc>>,
+                          bool> = true>
 auto allocate_unique(Alloc&& alloc, Args&&... args)
-    -> muc::unique_alloc_ptr<T, Alloc> {
-    using traits =
-        typename std::allocator_traits<Alloc>::template rebind_traits<T>;
+    -> muc::unique_alloc_ptr<T, std::decay_t<Alloc>> {
+    using traits = typename std::allocator_traits<
+        std::decay_t<Alloc>>::template rebind_traits<T>;
     using alloc_t = typename traits::allocator_type;
     alloc_t my_alloc{std::forward<Alloc>(alloc)};
     auto hold_dealloc{[&my_alloc](auto p) {
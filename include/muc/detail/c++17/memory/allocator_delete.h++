@@ -58,9 +58,9 @@ struct allocator_delete : private std::remove_cv_t<Alloc> {
 
     /// @brief Default constructor, available only when the allocator is
     /// stateless
-    template<std::enable_if_t<
-                 std::allocator_traits<allocator_type>::is_always_equal::value,
-                 bool> = true>
+    template<typename A = allocator_type,
+             std::enable_if_t<std::allocator_traits<A>::is_always_equal::value,
+                              bool> = true>
     allocator_delete() :
         allocator_type{} {}
 
@@ -0,0 +1,71 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace muc::impl {
+
+/// @brief A standard allocator returning storage aligned to Alignment.
+template<typename T, std::size_t Alignment>
+class aligned_allocator {
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    static constexpr std::align_val_t alignment{
+        Alignment > alignof(T) ? Alignment : alignof(T)};
+
+public:
+    aligned_allocator() noexcept = default;
+
+    template<typename U>
+    aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept {}
+
+    auto allocate(std::size_t n) -> T* {
+        return static_cast<T*>(::operator new(n * sizeof(T), alignment));
+    }
+
+    auto deallocate(T* p, std::size_t n) noexcept -> void {
+        ::operator delete(p, n * sizeof(T), alignment);
+    }
+
+    template<typename U>
+    auto operator==(const aligned_allocator<U, Alignment>&) const noexcept
+        -> bool {
+        return true;
+    }
+
+    template<typename U>
+    auto operator!=(const aligned_allocator<U, Alignment>&) const noexcept
+        -> bool {
+        return false;
+    }
+};
+
+} // namespace muc::impl
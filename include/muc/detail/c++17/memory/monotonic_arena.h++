@@ -0,0 +1,240 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/common/inline_macro.h++"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace muc {
+
+/// @brief A bump allocator over a chain of memory blocks.
+/// @details Allocation advances a pointer in the current block, and a new
+/// block at least twice as large as the last one is chained when it runs out.
+/// Deallocation is a no-op: memory is given back in bulk by `reset()` or
+/// `release()`. This suits objects that all die together, e.g. those of an
+/// event. Not thread-safe.
+class monotonic_arena {
+public:
+    /// @brief Constructs an arena whose first block has initial_size bytes.
+    /// No memory is allocated before the first allocation.
+    explicit monotonic_arena(std::size_t initial_size = 4096) noexcept :
+        m_head{},
+        m_cursor{},
+        m_end{},
+        m_next_size{std::max(initial_size, min_block_size)} {}
+
+    ~monotonic_arena() {
+        release();
+    }
+
+    monotonic_arena(const monotonic_arena&) = delete;
+    monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+    /// @brief Allocates bytes bytes aligned to alignment.
+    /// @throw std::bad_alloc if a new block cannot be allocated
+    MUC_ALWAYS_INLINE auto allocate(std::size_t bytes,
+                                    std::size_t alignment = alignof(
+                                        std::max_align_t)) -> void* {
+        const auto p{align_up(m_cursor, alignment)};
+        if (p + bytes > m_end or m_cursor == 0) {
+            return grow(bytes, alignment);
+        }
+        m_cursor = p + bytes;
+        return reinterpret_cast<void*>(p);
+    }
+
+    /// @brief Does nothing, memory is reclaimed by reset() or release().
+    auto deallocate(void*, std::size_t,
+                    std::size_t = alignof(std::max_align_t)) noexcept -> void {}
+
+    /// @brief Makes all memory available again while keeping it allocated.
+    /// If more than one block is in use, they are replaced by a single block
+    /// of their total size, so an arena reset once per event stops allocating
+    /// after the first few events.
+    /// @warning All memory previously allocated from the arena is invalidated.
+    auto reset() -> void {
+        if (m_head == nullptr) {
+            return;
+        }
+        if (m_head->next != nullptr) {
+            std::size_t total{};
+            for (auto b{m_head}; b != nullptr; b = b->next) {
+                total += b->size;
+            }
+            release();
+            m_next_size = total;
+            add_block(total);
+        }
+        m_cursor = data_of(m_head);
+    }
+
+    /// @brief Frees all blocks.
+    /// @warning All memory previously allocated from the arena is invalidated.
+    auto release() noexcept -> void {
+        while (m_head != nullptr) {
+            const auto b{std::exchange(m_head, m_head->next)};
+            ::operator delete(b, b->size, block_alignment);
+        }
+        m_cursor = 0;
+        m_end = 0;
+    }
+
+    /// @brief Total size of the blocks currently allocated, in bytes
+    auto capacity() const noexcept -> std::size_t {
+        std::size_t total{};
+        for (auto b{m_head}; b != nullptr; b = b->next) {
+            total += b->size;
+        }
+        return total;
+    }
+
+private:
+    struct alignas(std::max_align_t) block {
+        block* next;
+        std::size_t size; ///< including this header
+    };
+
+    static constexpr std::size_t min_block_size{256};
+    static constexpr std::align_val_t block_alignment{alignof(block)};
+
+    static auto align_up(std::uintptr_t p, std::size_t alignment) noexcept
+        -> std::uintptr_t {
+        return (p + alignment - 1) & ~(alignment - 1);
+    }
+
+    static auto data_of(block* b) noexcept -> std::uintptr_t {
+        return reinterpret_cast<std::uintptr_t>(b + 1);
+    }
+
+    auto add_block(std::size_t size) -> void {
+        const auto b{
+            static_cast<block*>(::operator new(size, block_alignment))};
+        b->next = m_head;
+        b->size = size;
+        m_head = b;
+        m_cursor = data_of(b);
+        m_end = reinterpret_cast<std::uintptr_t>(b) + size;
+    }
+
+    MUC_NOINLINE auto grow(std::size_t bytes, std::size_t alignment) -> void* {
+        const auto needed{sizeof(block) + bytes + alignment};
+        while (m_next_size < needed) {
+            m_next_size *= 2;
+        }
+        add_block(m_next_size);
+        m_next_size *= 2;
+        const auto p{align_up(m_cursor, alignment)};
+        m_cursor = p + bytes;
+        return reinterpret_cast<void*>(p);
+    }
+
+private:
+    block* m_head; ///< the current block, chained to the older ones
+    std::uintptr_t m_cursor;
+    std::uintptr_t m_end;
+    std::size_t m_next_size;
+};
+
+/// @brief A standard allocator allocating from a monotonic_arena.
+/// @details Holds a pointer to the arena, so copies are cheap and all refer
+/// to the same arena. Works with `allocate_unique` and standard containers.
+/// @tparam T The value type
+template<typename T>
+class arena_allocator {
+public:
+    using value_type = T;
+
+public:
+    arena_allocator(monotonic_arena& arena) noexcept :
+        m_arena{&arena} {}
+
+    template<typename U>
+    arena_allocator(const arena_allocator<U>& other) noexcept :
+        m_arena{&other.arena()} {}
+
+    MUC_ALWAYS_INLINE auto allocate(std::size_t n) -> T* {
+        return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    auto deallocate(T*, std::size_t) noexcept -> void {}
+
+    auto arena() const noexcept -> monotonic_arena& {
+        return *m_arena;
+    }
+
+    template<typename U>
+    auto operator==(const arena_allocator<U>& other) const noexcept -> bool {
+        return m_arena == &other.arena();
+    }
+
+    template<typename U>
+    auto operator!=(const arena_allocator<U>& other) const noexcept -> bool {
+        return m_arena != &other.arena();
+    }
+
+private:
+    monotonic_arena* m_arena;
+};
+
+namespace pmr {
+
+/// @brief A std::pmr::memory_resource allocating from a monotonic_arena.
+/// @details Unlike std::pmr::monotonic_buffer_resource, the arena can be
+/// reset and reused without freeing its memory.
+class arena_resource : public std::pmr::memory_resource {
+public:
+    arena_resource(monotonic_arena& arena) noexcept :
+        m_arena{&arena} {}
+
+    auto arena() const noexcept -> monotonic_arena& {
+        return *m_arena;
+    }
+
+private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment)
+        -> void* override {
+        return m_arena->allocate(bytes, alignment);
+    }
+
+    auto do_deallocate(void*, std::size_t, std::size_t) -> void override {}
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+        -> bool override {
+        const auto that{dynamic_cast<const arena_resource*>(&other)};
+        return that != nullptr and that->m_arena == m_arena;
+    }
+
+private:
+    monotonic_arena* m_arena;
+};
+
+} // namespace pmr
+
+} // namespace muc
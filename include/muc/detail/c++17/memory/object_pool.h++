@@ -0,0 +1,290 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/common/inline_macro.h++"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace muc {
+
+/// @brief A pool of fixed-size chunks for objects of type T.
+/// @details Free chunks form an intrusive singly-linked list, so that
+/// allocation and deallocation are a few instructions. Chunks are carved out
+/// of blocks of chunks_per_block chunks, which are only given back when the
+/// pool is destroyed or by `release()`. `reset()` makes all chunks available
+/// at once, which is the cheapest way to drop all objects of an event.
+///
+/// The pool is meant to be used by the thread that constructed it. With
+/// CrossThreadFree, other threads may also deallocate: their chunks are
+/// pushed onto a lock-free list that the owner takes over when its own list
+/// runs dry. Allocation is still reserved to the owner.
+///
+/// The pool is itself an allocator of T, use it through `std::ref` with
+/// `allocate_unique` or with `muc::pool_ptrvec`.
+/// @tparam T The object type
+/// @tparam CrossThreadFree Whether threads other than the owner may
+/// deallocate
+template<typename T, bool CrossThreadFree = false>
+class object_pool {
+public:
+    using value_type = T;
+
+    /// @brief Alignment of a chunk, in bytes
+    static constexpr std::size_t chunk_alignment{
+        std::max(alignof(T), alignof(void*))};
+    /// @brief Size of a chunk, in bytes
+    static constexpr std::size_t chunk_size{
+        (std::max(sizeof(T), sizeof(void*)) + chunk_alignment - 1) /
+        chunk_alignment * chunk_alignment};
+
+public:
+    explicit object_pool(std::size_t chunks_per_block = 1024) noexcept :
+        m_free{},
+        m_cursor{},
+        m_end{},
+        m_current{},
+        m_head{},
+        m_chunks_per_block{std::max<std::size_t>(chunks_per_block, 1)},
+        m_remote{},
+        m_owner{std::this_thread::get_id()} {}
+
+    ~object_pool() {
+        release();
+    }
+
+    object_pool(const object_pool&) = delete;
+    object_pool& operator=(const object_pool&) = delete;
+
+    /// @brief Allocates storage for one T.
+    /// @param n Must be 1
+    /// @throw std::bad_alloc if a new block cannot be allocated
+    MUC_ALWAYS_INLINE auto allocate([[maybe_unused]] std::size_t n = 1) -> T* {
+        assert(n == 1);
+        if (m_free != nullptr) {
+            return reinterpret_cast<T*>(
+                std::exchange(m_free, m_free->next));
+        }
+        if (m_cursor != m_end) {
+            return reinterpret_cast<T*>(
+                std::exchange(m_cursor, m_cursor + chunk_size));
+        }
+        return refill();
+    }
+
+    /// @brief Gives back storage obtained from allocate().
+    /// @param p The storage
+    /// @param n Must be 1
+    MUC_ALWAYS_INLINE auto deallocate(T* p, [[maybe_unused]] std::size_t n = 1)
+        -> void {
+        assert(n == 1);
+        const auto node{reinterpret_cast<free_chunk*>(p)};
+        if constexpr (CrossThreadFree) {
+            if (std::this_thread::get_id() != m_owner) {
+                node->next = m_remote.load(std::memory_order_relaxed);
+                while (not m_remote.compare_exchange_weak(
+                    node->next, node, std::memory_order_release,
+                    std::memory_order_relaxed)) {}
+                return;
+            }
+        }
+        node->next = std::exchange(m_free, node);
+    }
+
+    /// @brief Makes all chunks available again while keeping the blocks.
+    /// @warning Objects still living in the pool are not destroyed, and
+    /// their storage is reused.
+    auto reset() noexcept -> void {
+        m_free = nullptr;
+        if constexpr (CrossThreadFree) {
+            m_remote.store(nullptr, std::memory_order_relaxed);
+        }
+        m_current = m_head;
+        if (m_current != nullptr) {
+            m_cursor = first_chunk(m_current);
+            m_end = m_cursor + chunk_size * m_chunks_per_block;
+        }
+    }
+
+    /// @brief Frees all blocks.
+    /// @warning Objects still living in the pool are not destroyed.
+    auto release() noexcept -> void {
+        while (m_head != nullptr) {
+            ::operator delete(std::exchange(m_head, m_head->next),
+                              block_size(), block_alignment);
+        }
+        m_free = nullptr;
+        m_cursor = nullptr;
+        m_end = nullptr;
+        m_current = nullptr;
+        if constexpr (CrossThreadFree) {
+            m_remote.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    auto operator==(const object_pool& other) const noexcept -> bool {
+        return this == &other;
+    }
+
+    auto operator!=(const object_pool& other) const noexcept -> bool {
+        return this != &other;
+    }
+
+private:
+    struct free_chunk {
+        free_chunk* next;
+    };
+
+    struct block {
+        block* next;
+    };
+
+    static constexpr std::size_t header_size{
+        (sizeof(block) + chunk_alignment - 1) / chunk_alignment *
+        chunk_alignment};
+    static constexpr std::align_val_t block_alignment{
+        std::max(alignof(block), chunk_alignment)};
+
+    auto block_size() const noexcept -> std::size_t {
+        return header_size + chunk_size * m_chunks_per_block;
+    }
+
+    static auto first_chunk(block* b) noexcept -> std::byte* {
+        return reinterpret_cast<std::byte*>(b) + header_size;
+    }
+
+    MUC_NOINLINE auto refill() -> T* {
+        if constexpr (CrossThreadFree) {
+            m_free = m_remote.exchange(nullptr, std::memory_order_acquire);
+            if (m_free != nullptr) {
+                return reinterpret_cast<T*>(
+                    std::exchange(m_free, m_free->next));
+            }
+        }
+        // Blocks kept by reset() come first, in the order they were added
+        if (m_current == nullptr or m_current->next == nullptr) {
+            const auto b{static_cast<block*>(
+                ::operator new(block_size(), block_alignment))};
+            b->next = nullptr;
+            if (m_current == nullptr) {
+                m_head = b;
+            } else {
+                m_current->next = b;
+            }
+            m_current = b;
+        } else {
+            m_current = m_current->next;
+        }
+        m_cursor = first_chunk(m_current);
+        m_end = m_cursor + chunk_size * m_chunks_per_block;
+        return reinterpret_cast<T*>(
+            std::exchange(m_cursor, m_cursor + chunk_size));
+    }
+
+private:
+    free_chunk* m_free;
+    std::byte* m_cursor; ///< next never used chunk of the current block
+    std::byte* m_end;
+    block* m_current;
+    block* m_head;
+    std::size_t m_chunks_per_block;
+    std::atomic<free_chunk*> m_remote; ///< chunks freed by other threads
+    std::thread::id m_owner;
+};
+
+namespace pmr {
+
+/// @brief A std::pmr::memory_resource serving small requests from an
+/// object_pool.
+/// @details Requests that fit in a chunk of the pool are served by the pool,
+/// larger or over-aligned ones by the upstream resource. Useful for node-based
+/// pmr containers, whose node size is usually not known in advance: pick a T
+/// at least as large as the nodes, e.g. `std::array<std::byte, 64>`.
+/// @tparam T The object type of the pool
+/// @tparam CrossThreadFree See object_pool
+template<typename T, bool CrossThreadFree = false>
+class pool_resource : public std::pmr::memory_resource {
+public:
+    using pool_type = object_pool<T, CrossThreadFree>;
+
+public:
+    pool_resource(pool_type& pool,
+                  std::pmr::memory_resource* upstream =
+                      std::pmr::get_default_resource()) noexcept :
+        m_pool{&pool},
+        m_upstream{upstream} {}
+
+    auto pool() const noexcept -> pool_type& {
+        return *m_pool;
+    }
+
+    auto upstream_resource() const noexcept -> std::pmr::memory_resource* {
+        return m_upstream;
+    }
+
+private:
+    static auto fits(std::size_t bytes, std::size_t alignment) noexcept
+        -> bool {
+        return bytes <= pool_type::chunk_size and
+               alignment <= pool_type::chunk_alignment;
+    }
+
+    auto do_allocate(std::size_t bytes, std::size_t alignment)
+        -> void* override {
+        if (fits(bytes, alignment)) {
+            return m_pool->allocate(1);
+        }
+        return m_upstream->allocate(bytes, alignment);
+    }
+
+    auto do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+        -> void override {
+        if (fits(bytes, alignment)) {
+            m_pool->deallocate(static_cast<T*>(p), 1);
+        } else {
+            m_upstream->deallocate(p, bytes, alignment);
+        }
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+        -> bool override {
+        const auto that{dynamic_cast<const pool_resource*>(&other)};
+        return that != nullptr and that->m_pool == m_pool and
+               *that->m_upstream == *m_upstream;
+    }
+
+private:
+    pool_type* m_pool;
+    std::pmr::memory_resource* m_upstream;
+};
+
+} // namespace pmr
+
+} // namespace muc
@@ -218,6 +218,95 @@ constexpr auto brent(F&& f, T x1, T x2, int max_iter = 300,
     return {b, false};
 }
 
+/// @brief ITP (Interpolate, Truncate, Project) method for finding roots of a
+/// function.
+/// This function implements the ITP method of Oliveira and Takahashi (2020).
+/// Each step takes the regula falsi point, truncates it towards the midpoint
+/// and projects it into a shrinking neighbourhood of the midpoint. It
+/// converges superlinearly on smooth functions like Brent's method, but in the
+/// worst case needs at most one function evaluation more than bisection.
+/// Hyperparameters are kappa1 = 0.2 / |x2 - x1|, kappa2 = 2 and n0 = 1.
+/// @tparam T The type of the input value.
+/// @tparam F The type of the function to evaluate.
+/// @param f The function to evaluate.
+/// @param x1 One end of the bracket.
+/// @param x2 The other end of the bracket.
+/// @param max_iter The maximum number of iterations allowed (default is 300).
+/// @param tol The tolerance configuration for convergence (default is
+/// `tolerance<T>{}`).
+/// @return A pair containing the root value and a boolean indicating if
+/// convergence was achieved.
+template<typename T, typename F,
+         std::enable_if_t<std::is_floating_point_v<T> and
+                              std::is_invocable_r_v<T, F, T>,
+                          bool> = true>
+constexpr auto itp(F&& f, T x1, T x2, int max_iter = 300,
+                   tolerance<T> tol = {}) -> std::pair<T, bool> {
+    auto a{std::min(x1, x2)};
+    auto b{std::max(x1, x2)};
+    auto fa{f(a)};
+    auto fb{f(b)};
+    if (fa == 0) {
+        return {a, true};
+    }
+    if (fb == 0) {
+        return {b, true};
+    }
+    // Check if there is a single zero in range
+    if (muc::isnan(fa) or muc::isnan(fb) or (fa > 0) == (fb > 0)) {
+        return {b, false};
+    }
+    // Orient f so that f(a) < 0 < f(b)
+    const T s{fa < 0 ? T{1} : T{-1}};
+    fa *= s;
+    fb *= s;
+    const auto kappa1{T{0.2} / (b - a)};
+    // r_max = eps 2^(n_1/2 + n0 - j), where n_1/2 = ceil(log2((b - a) / 2eps))
+    // and eps is the tolerance on the initial bracket
+    const auto eps{tol.at(a, b) / 2};
+    auto r_max{2 * eps};
+    for (auto w{b - a}; w > 2 * eps and r_max < std::numeric_limits<T>::max();
+         w /= 2) {
+        r_max *= 2;
+    }
+    // Start search
+    for (int j{}; j < max_iter; ++j) {
+        if (b - a <= tol.at(a, b)) {
+            return {muc::midpoint(a, b), true};
+        }
+        const auto xh{muc::midpoint(a, b)};
+        // Once past n_max steps (the tolerance shrank with the bracket), this
+        // falls back to bisection
+        const auto r{std::max(r_max - (b - a) / 2, T{})};
+        const auto delta{kappa1 * (b - a) * (b - a)};
+        // Interpolate
+        const auto xf{(b * fa - a * fb) / (fa - fb)};
+        const auto dist{xh - xf};
+        // Truncate
+        const auto xt{delta <= muc::abs(dist) ?
+                          xf + (dist < 0 ? -delta : delta) :
+                          xh};
+        // Project
+        const auto x{muc::abs(xt - xh) <= r ? xt : xh - (dist < 0 ? -r : r)};
+        const auto fx{s * f(x)};
+        if (muc::isnan(fx)) {
+            break;
+        }
+        if (fx > 0) {
+            b = x;
+            fb = fx;
+        } else if (fx < 0) {
+            a = x;
+            fa = fx;
+        } else {
+            return {x, true};
+        }
+        r_max /= 2;
+    }
+    // nan or max_iter reached
+    return {muc::midpoint(a, b), false};
+}
+
 } // namespace muc::find_root
 
 #ifdef MUC_STATIC_TEST
@@ -252,4 +341,13 @@ static_assert([] {
     return converged and muc::abs(x - 1) < 2 * muc::tolerance<double>{}.at(x);
 }());
 
+static_assert([] {
+    const auto [x, converged]{muc::find_root::itp(
+        [](auto x) {
+            return x * x - 1;
+        },
+        0.5, 2.5)};
+    return converged and muc::abs(x - 1) < 2 * muc::tolerance<double>{}.at(x);
+}());
+
 #endif
@@ -22,6 +22,9 @@
 
 #pragma once
 
+#include "muc/detail/c++17/memory/allocator_delete.h++"
+#include "muc/detail/c++17/memory/object_pool.h++"
+
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -36,5 +39,10 @@ template<typename T>
 using shared_ptrvec = std::vector<std::shared_ptr<T>>;
 template<typename T>
 using weak_ptrvec = std::vector<std::weak_ptr<T>>;
+/// @brief unique_ptrvec of objects living in a pool, to be filled with
+/// `muc::allocate_unique<T>(std::ref(pool), ...)`. The pool must outlive the
+/// pointers.
+template<typename T, typename Pool = object_pool<T>>
+using pool_ptrvec = unique_ptrvec<T, allocator_delete<T, Pool&>>;
 
 } // namespace muc
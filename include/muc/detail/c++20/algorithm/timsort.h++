@@ -55,11 +55,25 @@
 #define GFX_TIMSORT_HPP
 
 #include <algorithm>
+#include <array>
+#include <barrier>
+#include <cstddef>
+#include <cstring>
 #include <functional>
 #include <iterator>
+#include <latch>
+#include <memory>
+#include <memory_resource>
 #include <ranges>
+#include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
+#include <version>
+
+#if __has_include(<execution>)
+#include <execution>
+#endif
 
 // Semantic versioning macros
 
@@ -92,6 +106,59 @@
 
 namespace muc {
 
+namespace detail {
+
+template<typename RandomAccessIterator,
+         typename Allocator =
+             std::allocator<std::iter_value_t<RandomAccessIterator>>>
+class TimSort;
+
+} // namespace detail
+
+/**
+ * Reusable scratch storage for muc::timsort and muc::timmerge. The merge
+ * buffer of a workspace keeps its capacity between calls, so a workspace kept
+ * per thread and passed to every call stops allocating once it has grown to
+ * the largest merge seen (or after reserve()).
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class timsort_workspace {
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    timsort_workspace() = default;
+
+    explicit timsort_workspace(const Allocator& alloc) :
+        m_buffer(alloc) {}
+
+    /**
+     * Preallocates enough storage to sort or merge n elements without any
+     * further allocation.
+     */
+    auto reserve(std::size_t n) -> void {
+        m_buffer.reserve(n / 2);
+    }
+
+    auto get_allocator() const -> allocator_type {
+        return m_buffer.get_allocator();
+    }
+
+private:
+    template<typename, typename>
+    friend class detail::TimSort;
+
+    std::vector<T, Allocator> m_buffer;
+};
+
+namespace pmr {
+
+template<typename T>
+using timsort_workspace =
+    muc::timsort_workspace<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
 // ---------------------------------------
 // Implementation details
 // ---------------------------------------
@@ -105,22 +172,66 @@ struct run {
     Iterator base;
     diff_t len;
 
+    run() = default;
+
     run(Iterator b, diff_t l) :
         base(b),
         len(l) {}
 };
 
-template<typename RandomAccessIterator>
+// Fixed-capacity stack of pending runs. The merge invariants make run lengths
+// grow at least as fast as the Fibonacci numbers from the bottom to the top of
+// the stack, hence 85 entries are enough for any range (see MAX_MERGE_PENDING
+// in Python's listobject.c).
+template<typename Iterator>
+class run_stack {
+    using diff_t = typename std::iterator_traits<Iterator>::difference_type;
+
+    static constexpr std::size_t MAX_MERGE_PENDING = 85;
+
+    std::array<run<Iterator>, MAX_MERGE_PENDING> runs_;
+    std::size_t size_ = 0;
+
+public:
+    std::size_t size() const {
+        return size_;
+    }
+
+    void emplace_back(Iterator const base, diff_t const len) {
+        GFX_TIMSORT_ASSERT(size_ < MAX_MERGE_PENDING);
+        runs_[size_++] = run<Iterator>(base, len);
+    }
+
+    void pop_back() {
+        GFX_TIMSORT_ASSERT(size_ > 0);
+        --size_;
+    }
+
+    run<Iterator>& operator[](std::size_t const i) {
+        return runs_[i];
+    }
+};
+
+template<typename RandomAccessIterator, typename Allocator>
 class TimSort {
     using iter_t = RandomAccessIterator;
     using diff_t = std::iter_difference_t<iter_t>;
+    using value_t = std::iter_value_t<iter_t>;
+    using workspace_t = timsort_workspace<value_t, Allocator>;
 
     static constexpr int MIN_MERGE = 32;
     static constexpr int MIN_GALLOP = 7;
 
+    // merge buffers of trivial types are filled with memcpy and never shrink
+    static constexpr bool MEMCPY_TMP =
+        std::contiguous_iterator<iter_t> && std::is_trivial_v<value_t>;
+
     int minGallop_ = MIN_GALLOP;
-    std::vector<std::iter_value_t<iter_t>> tmp_; // temp storage for merges
-    std::vector<run<RandomAccessIterator>> pending_;
+    std::vector<value_t, Allocator>& tmp_; // temp storage for merges
+    run_stack<RandomAccessIterator> pending_;
+
+    explicit TimSort(workspace_t& workspace) :
+        tmp_(workspace.m_buffer) {}
 
     template<typename Compare, typename Projection>
     static void binarySort(iter_t const lo, iter_t const hi, iter_t start,
@@ -670,14 +781,35 @@ epilogue: // merge what is left from either cursor1 or cursor2
     }
 
     void move_to_tmp(iter_t const begin, diff_t len) {
-        tmp_.assign(std::make_move_iterator(begin),
-                    std::make_move_iterator(begin + len));
+        if constexpr (MEMCPY_TMP) {
+            if (tmp_.size() < static_cast<std::size_t>(len)) {
+                tmp_.resize(len);
+            }
+            std::memcpy(tmp_.data(), std::to_address(begin),
+                        len * sizeof(value_t));
+        } else {
+            tmp_.assign(std::make_move_iterator(begin),
+                        std::make_move_iterator(begin + len));
+        }
+    }
+
+    void release_tmp() {
+        if constexpr (!MEMCPY_TMP) {
+            tmp_.clear(); // destroy moved-from objects, keep the capacity
+        }
     }
 
 public:
     template<typename Compare, typename Projection>
     static void merge(iter_t const lo, iter_t const mid, iter_t const hi,
                       Compare comp, Projection proj) {
+        workspace_t workspace;
+        merge(lo, mid, hi, workspace, std::move(comp), std::move(proj));
+    }
+
+    template<typename Compare, typename Projection>
+    static void merge(iter_t const lo, iter_t const mid, iter_t const hi,
+                      workspace_t& workspace, Compare comp, Projection proj) {
         GFX_TIMSORT_ASSERT(lo <= mid);
         GFX_TIMSORT_ASSERT(mid <= hi);
 
@@ -685,18 +817,26 @@ public:
             return; // nothing to do
         }
 
-        TimSort ts;
+        TimSort ts(workspace);
         ts.mergeConsecutiveRuns(lo, mid - lo, mid, hi - mid, std::move(comp),
                                 std::move(proj));
 
         GFX_TIMSORT_LOG("1st size: " << (mid - lo)
                                      << "; 2nd size: " << (hi - mid)
                                      << "; tmp_.size(): " << ts.tmp_.size());
+        ts.release_tmp();
     }
 
     template<typename Compare, typename Projection>
     static void sort(iter_t const lo, iter_t const hi, Compare comp,
                      Projection proj) {
+        workspace_t workspace;
+        sort(lo, hi, workspace, std::move(comp), std::move(proj));
+    }
+
+    template<typename Compare, typename Projection>
+    static void sort(iter_t const lo, iter_t const hi, workspace_t& workspace,
+                     Compare comp, Projection proj) {
         GFX_TIMSORT_ASSERT(lo <= hi);
 
         auto nRemaining = hi - lo;
@@ -711,7 +851,7 @@ public:
             return;
         }
 
-        TimSort ts;
+        TimSort ts(workspace);
         auto minRun = minRunLength(nRemaining);
         auto cur = lo;
         do {
@@ -737,9 +877,331 @@ public:
         GFX_TIMSORT_LOG("size: " << (hi - lo)
                                  << " tmp_.size(): " << ts.tmp_.size()
                                  << " pending_.size(): " << ts.pending_.size());
+        ts.release_tmp();
     }
 };
 
+template<typename RandomAccessIterator>
+class ParallelTimSort {
+    using iter_t = RandomAccessIterator;
+    using diff_t = std::iter_difference_t<iter_t>;
+    using value_t = std::iter_value_t<iter_t>;
+
+    // below this many elements per thread, spawning threads does not pay off
+    static constexpr diff_t MIN_CHUNK = 1 << 13;
+
+    // uninitialized scratch storage, fully constructed by the first pass if
+    // the threads could be started
+    class Buffer {
+    public:
+        explicit Buffer(diff_t const size) :
+            data_(std::allocator<value_t>{}.allocate(size)),
+            size_(size) {}
+
+        Buffer(Buffer const&) = delete;
+        Buffer& operator=(Buffer const&) = delete;
+
+        ~Buffer() {
+            if (constructed_) {
+                std::destroy_n(data_, size_);
+            }
+            std::allocator<value_t>{}.deallocate(data_, size_);
+        }
+
+        void setConstructed() {
+            constructed_ = true;
+        }
+
+        value_t* data() const {
+            return data_;
+        }
+
+    private:
+        value_t* data_;
+        diff_t size_;
+        bool constructed_ = false;
+    };
+
+    static diff_t sliceBound(diff_t const n, int const nSlices, int const i) {
+        return n * i / nSlices;
+    }
+
+    // Runs f(0), ..., f(nThreads - 1) concurrently. Returns false, without
+    // having called f, if the threads cannot be started: the workers only
+    // begin once all of them exist, as the ones already running would
+    // otherwise wait forever at a barrier for the missing ones.
+    template<typename F>
+    static bool parallelFor(int const nThreads, F const& f) {
+        std::latch start(1);
+        bool started = false;
+        std::vector<std::jthread> workers;
+        try {
+            workers.reserve(nThreads - 1);
+            for (int t = 1; t < nThreads; ++t) {
+                workers.emplace_back([&f, &start, &started, t] {
+                    start.wait();
+                    if (started) {
+                        f(t);
+                    }
+                });
+            }
+        } catch (...) {
+            start.count_down();
+            return false;
+        }
+        started = true;
+        start.count_down();
+        f(0);
+        return true;
+    }
+
+    // Number of elements of [a, a + lenA) among the first k elements of the
+    // stable merge of [a, a + lenA) and [b, b + lenB)
+    template<typename Iter, typename Compare, typename Projection>
+    static diff_t coRank(diff_t const k, Iter const a, diff_t const lenA,
+                         Iter const b, diff_t const lenB, Compare comp,
+                         Projection proj) {
+        auto lo = (std::max)(diff_t{0}, k - lenB);
+        auto hi = (std::min)(k, lenA);
+        while (lo < hi) {
+            auto const i = lo + (hi - lo) / 2;
+            // a[i] goes before b[k - i - 1] unless the latter is strictly less
+            if (!std::invoke(comp, std::invoke(proj, b[k - i - 1]),
+                             std::invoke(proj, a[i]))) {
+                lo = i + 1;
+            } else {
+                hi = i;
+            }
+        }
+        return lo;
+    }
+
+    template<typename Src, typename Dst, typename Compare, typename Projection>
+    static void moveMerge(Src first1, Src const last1, Src first2,
+                          Src const last2, Dst dest, Compare comp,
+                          Projection proj) {
+        if (first1 != last1 && first2 != last2 &&
+            std::invoke(comp, std::invoke(proj, *first2),
+                        std::invoke(proj, *std::ranges::prev(last1)))) {
+            while (true) {
+                if (std::invoke(comp, std::invoke(proj, *first2),
+                                std::invoke(proj, *first1))) {
+                    *dest = std::ranges::iter_move(first2);
+                    ++dest;
+                    if (++first2 == last2) {
+                        break;
+                    }
+                } else {
+                    *dest = std::ranges::iter_move(first1);
+                    ++dest;
+                    if (++first1 == last1) {
+                        break;
+                    }
+                }
+            }
+        }
+        dest = std::ranges::move(first1, last1, dest).out;
+        std::ranges::move(first2, last2, dest);
+    }
+
+    // Thread t's share of merging each pair of adjacent sorted blocks of src
+    // (delimited by bounds) into dst. The output is cut into nThreads equal
+    // slices, so that a large merge is shared by several threads, each one
+    // starting at a co-ranked split point. All threads find their split points
+    // before any of them moves anything out of src. Thread t writes exactly
+    // slice t of dst.
+    template<typename Src, typename Dst, typename Compare, typename Projection>
+    static void mergeSlice(Src const src, Dst const dst,
+                           std::vector<diff_t> const& bounds,
+                           int const nThreads, int const t,
+                           std::barrier<>& sync, Compare comp,
+                           Projection proj) {
+        struct piece {
+            diff_t first1, last1, first2, last2, dest;
+        };
+
+        auto const nBlocks = bounds.size() - 1;
+        auto const n = bounds.back();
+        auto const sliceLo = sliceBound(n, nThreads, t);
+        auto const sliceHi = sliceBound(n, nThreads, t + 1);
+        std::vector<piece> pieces;
+        for (std::size_t g = 0; g < nBlocks; g += 2) {
+            auto const lo = bounds[g];
+            auto const mid = bounds[g + 1];
+            auto const hi = g + 2 <= nBlocks ? bounds[g + 2] : mid;
+            if (lo >= sliceHi) {
+                break;
+            }
+            auto const from = (std::max)(sliceLo, lo);
+            auto const to = (std::min)(sliceHi, hi);
+            if (from >= to) {
+                continue;
+            }
+
+            auto const i0 = coRank(from - lo, src + lo, mid - lo, src + mid,
+                                   hi - mid, comp, proj);
+            auto const i1 = coRank(to - lo, src + lo, mid - lo, src + mid,
+                                   hi - mid, comp, proj);
+            pieces.push_back({lo + i0, lo + i1, mid + (from - lo - i0),
+                              mid + (to - lo - i1), from});
+        }
+
+        sync.arrive_and_wait();
+
+        for (auto&& p : pieces) {
+            moveMerge(src + p.first1, src + p.last1, src + p.first2,
+                      src + p.last2, dst + p.dest, comp, proj);
+        }
+    }
+
+    // Block bounds after merging each pair of adjacent blocks
+    static void mergeBounds(std::vector<diff_t>& bounds) {
+        auto const n = bounds.back();
+        std::vector<diff_t> merged;
+        merged.reserve(bounds.size() / 2 + 2);
+        for (std::size_t g = 0; g < bounds.size(); g += 2) {
+            merged.push_back(bounds[g]);
+        }
+        if (merged.back() != n) {
+            merged.push_back(n);
+        }
+        bounds = std::move(merged);
+    }
+
+public:
+    template<typename Compare, typename Projection>
+    static void merge(iter_t const lo, iter_t const mid, iter_t const hi,
+                      int nThreads, Compare comp, Projection proj) {
+        GFX_TIMSORT_ASSERT(lo <= mid);
+        GFX_TIMSORT_ASSERT(mid <= hi);
+
+        if (lo == mid || mid == hi) {
+            return; // nothing to do
+        }
+
+        auto const n = hi - lo;
+        nThreads =
+            static_cast<int>((std::min)(diff_t{nThreads}, n / MIN_CHUNK));
+        if (nThreads < 2 ||
+            !std::invoke(comp, std::invoke(proj, *mid),
+                         std::invoke(proj, *std::ranges::prev(mid)))) {
+            return TimSort<iter_t>::merge(lo, mid, hi, comp, proj);
+        }
+
+        Buffer buffer(n);
+        std::vector<diff_t> const bounds{0, mid - lo, n};
+        std::barrier sync(nThreads);
+        bool const parallel = parallelFor(nThreads, [&](int const t) {
+            auto const first = sliceBound(n, nThreads, t);
+            auto const last = sliceBound(n, nThreads, t + 1);
+            std::ranges::uninitialized_move(lo + first, lo + last,
+                                            buffer.data() + first,
+                                            buffer.data() + last);
+            sync.arrive_and_wait();
+            mergeSlice(buffer.data(), lo, bounds, nThreads, t, sync, comp,
+                       proj);
+        });
+        if (!parallel) {
+            return TimSort<iter_t>::merge(lo, mid, hi, comp, proj);
+        }
+        buffer.setConstructed();
+
+        GFX_TIMSORT_LOG("1st size: " << (mid - lo)
+                                     << "; 2nd size: " << (hi - mid)
+                                     << "; threads: " << nThreads);
+    }
+
+    template<typename Compare, typename Projection>
+    static void sort(iter_t const lo, iter_t const hi, int nThreads,
+                     Compare comp, Projection proj) {
+        GFX_TIMSORT_ASSERT(lo <= hi);
+
+        auto const n = hi - lo;
+        nThreads =
+            static_cast<int>((std::min)(diff_t{nThreads}, n / MIN_CHUNK));
+        if (nThreads < 2) {
+            return TimSort<iter_t>::sort(lo, hi, comp, proj);
+        }
+
+        std::vector<diff_t> bounds(nThreads + 1);
+        for (int t = 0; t <= nThreads; ++t) {
+            bounds[t] = sliceBound(n, nThreads, t);
+        }
+
+        // Each thread finds and merges the natural runs of its own chunk, then
+        // moves the sorted chunk to the scratch buffer. The sorted chunks are
+        // then merged pairwise, ping-ponging between buffer and range, by the
+        // same threads: levels are separated by a barrier instead of spawning
+        // new threads for each of them.
+        Buffer buffer(n);
+        std::barrier sync(nThreads);
+        bool const parallel = parallelFor(nThreads, [&](int const t) {
+            auto const first = lo + bounds[t];
+            auto const last = lo + bounds[t + 1];
+            TimSort<iter_t>::sort(first, last, comp, proj);
+            std::ranges::uninitialized_move(first, last,
+                                            buffer.data() + bounds[t],
+                                            buffer.data() + bounds[t + 1]);
+
+            // every thread tracks the block bounds of each level on its own
+            auto levelBounds = bounds;
+            bool inBuffer = true;
+            while (levelBounds.size() > 2) {
+                sync.arrive_and_wait(); // the previous level is complete
+                if (inBuffer) {
+                    mergeSlice(buffer.data(), lo, levelBounds, nThreads, t,
+                               sync, comp, proj);
+                } else {
+                    mergeSlice(lo, buffer.data(), levelBounds, nThreads, t,
+                               sync, comp, proj);
+                }
+                mergeBounds(levelBounds);
+                inBuffer = !inBuffer;
+            }
+
+            // slice t of the buffer was written by this thread alone, but the
+            // others may still be reading the range
+            if (inBuffer) {
+                sync.arrive_and_wait();
+                auto const sliceLo = sliceBound(n, nThreads, t);
+                auto const sliceHi = sliceBound(n, nThreads, t + 1);
+                std::ranges::move(buffer.data() + sliceLo,
+                                  buffer.data() + sliceHi, lo + sliceLo);
+            }
+        });
+        if (!parallel) {
+            return TimSort<iter_t>::sort(lo, hi, comp, proj);
+        }
+        buffer.setConstructed();
+
+        GFX_TIMSORT_LOG("size: " << n << "; threads: " << nThreads);
+    }
+};
+
+#ifdef __cpp_lib_execution
+
+template<typename ExecutionPolicy>
+inline constexpr bool isSequencedPolicy =
+    std::is_same_v<std::remove_cvref_t<ExecutionPolicy>,
+                   std::execution::sequenced_policy>
+#if __cpp_lib_execution >= 201902L
+    || std::is_same_v<std::remove_cvref_t<ExecutionPolicy>,
+                      std::execution::unsequenced_policy>
+#endif
+    ;
+
+template<typename ExecutionPolicy>
+int policyThreadCount() {
+    if constexpr (isSequencedPolicy<ExecutionPolicy>) {
+        return 1;
+    } else {
+        return static_cast<int>(
+            (std::max)(std::thread::hardware_concurrency(), 1u));
+    }
+}
+
+#endif
+
 } // namespace detail
 
 // ---------------------------------------
@@ -812,6 +1274,246 @@ auto timsort(Range&& range, Compare comp = {}, Projection proj = {})
     return muc::timsort(std::begin(range), std::end(range), comp, proj);
 }
 
+/**
+ * Stably merges two consecutive sorted ranges [first, middle) and [middle,
+ * last) into one sorted range [first, last) with a comparison function and a
+ * projection function, using the merge buffer of a workspace.
+ */
+template<
+    std::random_access_iterator Iterator, std::sentinel_for<Iterator> Sentinel,
+    typename Allocator, typename Compare = std::ranges::less,
+    typename Projection = std::identity>
+    requires std::sortable<Iterator, Compare, Projection>
+auto timmerge(Iterator first, Iterator middle, Sentinel last,
+              timsort_workspace<std::iter_value_t<Iterator>, Allocator>&
+                  workspace,
+              Compare comp = {}, Projection proj = {}) -> Iterator {
+    auto last_it = std::ranges::next(first, last);
+    GFX_TIMSORT_AUDIT(std::ranges::is_sorted(first, middle, comp, proj) &&
+                      "Precondition");
+    GFX_TIMSORT_AUDIT(std::ranges::is_sorted(middle, last_it, comp, proj) &&
+                      "Precondition");
+    detail::TimSort<Iterator, Allocator>::merge(first, middle, last_it,
+                                                workspace, comp, proj);
+    GFX_TIMSORT_AUDIT(std::ranges::is_sorted(first, last_it, comp, proj) &&
+                      "Postcondition");
+    return last_it;
+}
+
+/**
+ * Stably merges two sorted halves [first, middle) and [middle, last) of a range
+ * into one sorted range [first, last) with a comparison function and a
+ * projection function, using the merge buffer of a workspace.
+ */
+template<std::ranges::random_access_range Range, typename Allocator,
+         typename Compare = std::ranges::less,
+         typename Projection = std::identity>
+    requires std::sortable<std::ranges::iterator_t<Range>, Compare, Projection>
+auto timmerge(Range&& range, std::ranges::iterator_t<Range> middle,
+              timsort_workspace<std::ranges::range_value_t<Range>, Allocator>&
+                  workspace,
+              Compare comp = {}, Projection proj = {})
+    -> std::ranges::borrowed_iterator_t<Range> {
+    return muc::timmerge(std::begin(range), middle, std::end(range), workspace,
+                         comp, proj);
+}
+
+/**
+ * Stably sorts a range with a comparison function and a projection function,
+ * using the merge buffer of a workspace.
+ */
+template<
+    std::random_access_iterator Iterator, std::sentinel_for<Iterator> Sentinel,
+    typename Allocator, typename Compare = std::ranges::less,
+    typename Projection = std::identity>
+    requires std::sortable<Iterator, Compare, Projection>
+auto timsort(Iterator first, Sentinel last,
+             timsort_workspace<std::iter_value_t<Iterator>, Allocator>&
+                 workspace,
+             Compare comp = {}, Projection proj = {}) -> Iterator {
+    auto last_it = std::ranges::next(first, last);
+    detail::TimSort<Iterator, Allocator>::sort(first, last_it, workspace, comp,
+                                               proj);
+    GFX_TIMSORT_AUDIT(std::ranges::is_sorted(first, last_it, comp, proj) &&
+                      "Postcondition");
+    return last_it;
+}
+
+/**
+ * Stably sorts a range with a comparison function and a projection function,
+ * using the merge buffer of a workspace.
+ */
+template<std::ranges::random_access_range Range, typename Allocator,
+         typename Compare = std::ranges::less,
+         typename Projection = std::identity>
+    requires std::sortable<std::ranges::iterator_t<Range>, Compare, Projection>
+auto timsort(Range&& range,
+             timsort_workspace<std::ranges::range_value_t<Range>, Allocator>&
+                 workspace,
+             Compare comp = {}, Projection proj = {})
+    -> std::ranges::borrowed_iterator_t<Range> {
+    return muc::timsort(std::begin(range), std::end(range), workspace, comp,
+                        proj);
+}
+
+/**
+ * Stably sorts each of the consecutive sub-ranges [begin + offsets[i],
+ * begin + offsets[i + 1]) of a range (e.g. the rows of a CSR layout) with a
+ * comparison function and a projection function, using the merge buffer of a
+ * single workspace for all of them.
+ */
+template<std::ranges::random_access_range Range,
+         std::ranges::input_range Offsets, typename Allocator,
+         typename Compare = std::ranges::less,
+         typename Projection = std::identity>
+    requires std::sortable<std::ranges::iterator_t<Range>, Compare,
+                           Projection> &&
+             std::integral<std::ranges::range_value_t<Offsets>>
+auto timsort_batch(Range&& range, Offsets&& offsets,
+                   timsort_workspace<std::ranges::range_value_t<Range>,
+                                     Allocator>& workspace,
+                   Compare comp = {}, Projection proj = {})
+    -> std::ranges::borrowed_iterator_t<Range> {
+    auto const first = std::ranges::begin(range);
+    auto offset = std::ranges::begin(offsets);
+    auto const offsets_end = std::ranges::end(offsets);
+    if (offset != offsets_end) {
+        auto lo = *offset;
+        while (++offset != offsets_end) {
+            auto const hi = *offset;
+            detail::TimSort<std::ranges::iterator_t<Range>, Allocator>::sort(
+                first + lo, first + hi, workspace, comp, proj);
+            GFX_TIMSORT_AUDIT(
+                std::ranges::is_sorted(first + lo, first + hi, comp, proj) &&
+                "Postcondition");
+            lo = hi;
+        }
+    }
+    return std::ranges::next(first, std::ranges::end(range));
+}
+
+/**
+ * Stably sorts each of the consecutive sub-ranges [begin + offsets[i],
+ * begin + offsets[i + 1]) of a range (e.g. the rows of a CSR layout) with a
+ * comparison function and a projection function.
+ */
+template<std::ranges::random_access_range Range,
+         std::ranges::input_range Offsets, typename Compare = std::ranges::less,
+         typename Projection = std::identity>
+    requires std::sortable<std::ranges::iterator_t<Range>, Compare,
+                           Projection> &&
+             std::integral<std::ranges::range_value_t<Offsets>>
+auto timsort_batch(Range&& range, Offsets&& offsets, Compare comp = {},
+                   Projection proj = {})
+    -> std::ranges::borrowed_iterator_t<Range> {
+    timsort_workspace<std::ranges::range_value_t<Range>> workspace;
+    return muc::timsort_batch(std::forward<Range>(range),
+                              std::forward<Offsets>(offsets), workspace, comp,
+                              proj);
+}
+
+#ifdef __cpp_lib_execution
+
+/**
+ * Stably merges two consecutive sorted ranges [first, middle) and [middle,
+ * last) into one sorted range [first, last) with a comparison function and a
+ * projection function, executed according to an execution policy.
+ *
+ * With a parallel policy, the merge is split at co-ranked points among
+ * std::thread::hardware_concurrency() threads, through a scratch buffer of
+ * last - first elements. If the buffer cannot be allocated,
+ * std::bad_alloc is thrown and the range is left untouched; if the threads
+ * cannot be started, the merge runs sequentially. As with the standard
+ * parallel algorithms, std::terminate is called if comp or proj throws.
+ */
+template<
+    typename ExecutionPolicy, std::random_access_iterator Iterator,
+    std::sentinel_for<Iterator> Sentinel, typename Compare = std::ranges::less,
+    typename Projection = std::identity>
+    requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>> &&
+             std::sortable<Iterator, Compare, Projection>
+auto timmerge(ExecutionPolicy&&, Iterator first, Iterator middle,
+              Sentinel last, Compare comp = {}, Projection proj = {})
+    -> Iterator {
+    auto last_it = std::ranges::next(first, last);
+    GFX_TIMSORT_AUDIT(std::ranges::is_sorted(first, middle, comp, proj) &&
+                      "Precondition");
+    GFX_TIMSORT_AUDIT(std::ranges::is_sorted(middle, last_it, comp, proj) &&
+                      "Precondition");
+    detail::ParallelTimSort<Iterator>::merge(
+        first, middle, last_it, detail::policyThreadCount<ExecutionPolicy>(),
+        comp, proj);
+    GFX_TIMSORT_AUDIT(std::ranges::is_sorted(first, last_it, comp, proj) &&
+                      "Postcondition");
+    return last_it;
+}
+
+/**
+ * Stably merges two sorted halves [first, middle) and [middle, last) of a range
+ * into one sorted range [first, last) with a comparison function and a
+ * projection function, executed according to an execution policy.
+ */
+template<typename ExecutionPolicy, std::ranges::random_access_range Range,
+         typename Compare = std::ranges::less,
+         typename Projection = std::identity>
+    requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>> &&
+             std::sortable<std::ranges::iterator_t<Range>, Compare, Projection>
+auto timmerge(ExecutionPolicy&& policy, Range&& range,
+              std::ranges::iterator_t<Range> middle, Compare comp = {},
+              Projection proj = {}) -> std::ranges::borrowed_iterator_t<Range> {
+    return muc::timmerge(std::forward<ExecutionPolicy>(policy),
+                         std::begin(range), middle, std::end(range), comp,
+                         proj);
+}
+
+/**
+ * Stably sorts a range with a comparison function and a projection function,
+ * executed according to an execution policy.
+ *
+ * With a parallel policy, the range is cut into one chunk per
+ * std::thread::hardware_concurrency() thread, the natural runs of every chunk
+ * are found and merged concurrently, and the sorted chunks are then merged
+ * pairwise, each merge being split at co-ranked points so that all threads
+ * stay busy. A scratch buffer of last - first elements is used. If it cannot
+ * be allocated, std::bad_alloc is thrown and the range is left untouched; if
+ * the threads cannot be started, the sort runs sequentially. As with the
+ * standard parallel algorithms, std::terminate is called if comp or proj
+ * throws.
+ */
+template<
+    typename ExecutionPolicy, std::random_access_iterator Iterator,
+    std::sentinel_for<Iterator> Sentinel, typename Compare = std::ranges::less,
+    typename Projection = std::identity>
+    requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>> &&
+             std::sortable<Iterator, Compare, Projection>
+auto timsort(ExecutionPolicy&&, Iterator first, Sentinel last,
+             Compare comp = {}, Projection proj = {}) -> Iterator {
+    auto last_it = std::ranges::next(first, last);
+    detail::ParallelTimSort<Iterator>::sort(
+        first, last_it, detail::policyThreadCount<ExecutionPolicy>(), comp,
+        proj);
+    GFX_TIMSORT_AUDIT(std::ranges::is_sorted(first, last_it, comp, proj) &&
+                      "Postcondition");
+    return last_it;
+}
+
+/**
+ * Stably sorts a range with a comparison function and a projection function,
+ * executed according to an execution policy.
+ */
+template<typename ExecutionPolicy, std::ranges::random_access_range Range,
+         typename Compare = std::ranges::less,
+         typename Projection = std::identity>
+    requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>> &&
+             std::sortable<std::ranges::iterator_t<Range>, Compare, Projection>
+auto timsort(ExecutionPolicy&& policy, Range&& range, Compare comp = {},
+             Projection proj = {}) -> std::ranges::borrowed_iterator_t<Range> {
+    return muc::timsort(std::forward<ExecutionPolicy>(policy),
+                        std::begin(range), std::end(range), comp, proj);
+}
+
+#endif
+
 } // namespace muc
 
 #undef GFX_TIMSORT_ENABLE_ASSERT
@@ -0,0 +1,326 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/common/inline_macro.h++"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace muc::chrono {
+
+/// @brief Timing statistics of a profiling zone.
+struct zone_stats {
+    /// @brief Number of histogram buckets: 4 per power of two, up to 2^64 ns
+    static constexpr std::size_t n_buckets{252};
+
+    std::string_view name;
+    std::uint64_t count{};
+    std::chrono::nanoseconds total{};
+    std::chrono::nanoseconds min{std::chrono::nanoseconds::max()};
+    std::chrono::nanoseconds max{};
+    std::array<std::uint64_t, n_buckets> histogram{};
+
+    /// @brief Index of the histogram bucket containing a duration in ns.
+    /// @details Buckets are exact below 4 ns, then split every power of two
+    /// into 4, so that a bucket spans at most 25% of its lower bound.
+    static constexpr auto bucket_of(std::uint64_t ns) noexcept -> std::size_t {
+        if (ns < 4) {
+            return ns;
+        }
+        const auto e{std::bit_width(ns) - 1};
+        return 4 * (e - 1) + (ns >> (e - 2) & 3);
+    }
+
+    /// @brief Smallest duration in ns falling in a histogram bucket
+    static constexpr auto bucket_lower_bound(std::size_t i) noexcept
+        -> std::uint64_t {
+        if (i < 4) {
+            return i;
+        }
+        return (4 + i % 4) << (i / 4 - 1);
+    }
+
+    auto mean() const noexcept -> std::chrono::nanoseconds {
+        return count == 0 ? std::chrono::nanoseconds{} :
+                            total / static_cast<std::int64_t>(count);
+    }
+
+    /// @brief Estimate of the q-quantile (0 <= q <= 1) from the histogram,
+    /// accurate to a bucket width
+    auto quantile(double q) const noexcept -> std::chrono::nanoseconds {
+        if (count == 0) {
+            return {};
+        }
+        const auto rank{static_cast<std::uint64_t>(q * (count - 1))};
+        std::uint64_t seen{};
+        for (std::size_t i{}; i < n_buckets; ++i) {
+            seen += histogram[i];
+            if (seen > rank) {
+                const auto upper{i + 1 < n_buckets ?
+                                     bucket_lower_bound(i + 1) - 1 :
+                                     std::numeric_limits<std::uint64_t>::max()};
+                return std::clamp(std::chrono::nanoseconds(upper), min, max);
+            }
+        }
+        return max;
+    }
+
+    auto merge(const zone_stats& other) noexcept -> void {
+        count += other.count;
+        total += other.total;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        for (std::size_t i{}; i < n_buckets; ++i) {
+            histogram[i] += other.histogram[i];
+        }
+    }
+};
+
+namespace impl {
+
+/// @brief Statistics of one zone in one thread.
+/// @details Written only by its owner thread, without any read-modify-write,
+/// and read by `zone_registry` at any time with relaxed loads.
+class zone_accumulator {
+public:
+    explicit zone_accumulator(std::string_view name);
+    ~zone_accumulator();
+
+    zone_accumulator(const zone_accumulator&) = delete;
+    zone_accumulator& operator=(const zone_accumulator&) = delete;
+
+    MUC_ALWAYS_INLINE auto record(std::uint64_t ns) noexcept -> void {
+        add(m_count, 1);
+        add(m_total, ns);
+        if (ns < m_min.load(std::memory_order::relaxed)) {
+            m_min.store(ns, std::memory_order::relaxed);
+        }
+        if (ns > m_max.load(std::memory_order::relaxed)) {
+            m_max.store(ns, std::memory_order::relaxed);
+        }
+        add(m_histogram[zone_stats::bucket_of(ns)], 1);
+    }
+
+    auto name() const noexcept -> std::string_view {
+        return m_name;
+    }
+
+    auto snapshot() const noexcept -> zone_stats {
+        zone_stats stats{.name = m_name};
+        stats.count = m_count.load(std::memory_order::relaxed);
+        stats.total = std::chrono::nanoseconds(
+            m_total.load(std::memory_order::relaxed));
+        stats.min = std::chrono::nanoseconds(std::min<std::uint64_t>(
+            m_min.load(std::memory_order::relaxed),
+            std::chrono::nanoseconds::max().count()));
+        stats.max =
+            std::chrono::nanoseconds(m_max.load(std::memory_order::relaxed));
+        for (std::size_t i{}; i < zone_stats::n_buckets; ++i) {
+            stats.histogram[i] =
+                m_histogram[i].load(std::memory_order::relaxed);
+        }
+        return stats;
+    }
+
+private:
+    MUC_ALWAYS_INLINE static auto add(std::atomic<std::uint64_t>& counter,
+                                      std::uint64_t value) noexcept -> void {
+        counter.store(counter.load(std::memory_order::relaxed) + value,
+                      std::memory_order::relaxed);
+    }
+
+private:
+    std::string_view m_name;
+    std::atomic<std::uint64_t> m_count{};
+    std::atomic<std::uint64_t> m_total{};
+    std::atomic<std::uint64_t> m_min{std::numeric_limits<std::uint64_t>::max()};
+    std::atomic<std::uint64_t> m_max{};
+    std::array<std::atomic<std::uint64_t>, zone_stats::n_buckets> m_histogram{};
+};
+
+} // namespace impl
+
+/// @brief Collects the statistics of all profiling zones of all threads.
+/// @details Per-thread statistics are merged on demand, so that the zones
+/// themselves never synchronize. Statistics of exited threads are kept.
+class zone_registry {
+public:
+    static auto instance() -> zone_registry& {
+        static zone_registry registry;
+        return registry;
+    }
+
+    zone_registry(const zone_registry&) = delete;
+    zone_registry& operator=(const zone_registry&) = delete;
+
+    /// @brief Statistics of every zone merged over all threads, sorted by
+    /// descending total time
+    auto collect() const -> std::vector<zone_stats> {
+        std::map<std::string_view, zone_stats> merged;
+        {
+            const std::scoped_lock lock{m_mutex};
+            merged = m_retired;
+            for (auto&& accumulator : m_live) {
+                merge_into(merged, accumulator->snapshot());
+            }
+        }
+        std::vector<zone_stats> result;
+        result.reserve(merged.size());
+        for (auto&& [_, stats] : merged) {
+            result.push_back(stats);
+        }
+        std::ranges::stable_sort(result, std::ranges::greater{},
+                                 &zone_stats::total);
+        return result;
+    }
+
+    /// @brief Writes a human-readable table of all zones
+    auto write_text(std::ostream& os) const -> void {
+        const auto flags{os.flags()};
+        const auto precision{os.precision()};
+        const auto zones{collect()};
+        std::size_t width{std::string_view{"zone"}.size()};
+        for (auto&& s : zones) {
+            width = std::max(width, s.name.size());
+        }
+        const auto name_width{static_cast<int>(width)};
+        os << std::left << std::setw(name_width) << "zone" << std::right
+           << std::setw(12) << "count" << std::setw(14) << "total/ms"
+           << std::setw(12) << "mean/ns" << std::setw(12) << "min/ns"
+           << std::setw(12) << "p50/ns" << std::setw(12) << "p99/ns"
+           << std::setw(12) << "max/ns" << '\n';
+        for (auto&& s : zones) {
+            os << std::left << std::setw(name_width) << s.name << std::right
+               << std::setw(12) << s.count << std::setw(14) << std::fixed
+               << std::setprecision(3) << s.total.count() / 1e6
+               << std::setw(12) << s.mean().count() << std::setw(12)
+               << s.min.count() << std::setw(12) << s.quantile(0.5).count()
+               << std::setw(12) << s.quantile(0.99).count() << std::setw(12)
+               << s.max.count() << '\n';
+        }
+        os.flags(flags);
+        os.precision(precision);
+    }
+
+    /// @brief Writes all zones as CSV, durations in ns
+    auto write_csv(std::ostream& os) const -> void {
+        os << "zone,count,total,mean,min,p50,p99,max\n";
+        for (auto&& s : collect()) {
+            os << '"' << s.name << "\"," << s.count << ',' << s.total.count()
+               << ',' << s.mean().count() << ',' << s.min.count() << ','
+               << s.quantile(0.5).count() << ',' << s.quantile(0.99).count()
+               << ',' << s.max.count() << '\n';
+        }
+    }
+
+    /// @brief Writes all zones as a JSON array, durations in ns, with the
+    /// non-empty histogram buckets as [lower bound, count] pairs
+    auto write_json(std::ostream& os) const -> void {
+        os << '[';
+        auto first{true};
+        for (auto&& s : collect()) {
+            os << (first ? "\n" : ",\n") << "  {\"zone\": \"";
+            for (auto c : s.name) {
+                if (c == '"' or c == '\\') {
+                    os << '\\';
+                }
+                os << c;
+            }
+            os << "\", \"count\": " << s.count
+               << ", \"total\": " << s.total.count()
+               << ", \"mean\": " << s.mean().count()
+               << ", \"min\": " << s.min.count()
+               << ", \"p50\": " << s.quantile(0.5).count()
+               << ", \"p99\": " << s.quantile(0.99).count()
+               << ", \"max\": " << s.max.count() << ", \"histogram\": [";
+            auto first_bucket{true};
+            for (std::size_t i{}; i < zone_stats::n_buckets; ++i) {
+                if (s.histogram[i] != 0) {
+                    os << (first_bucket ? "" : ",") << '['
+                       << zone_stats::bucket_lower_bound(i) << ", "
+                       << s.histogram[i] << ']';
+                    first_bucket = false;
+                }
+            }
+            os << "]}";
+            first = false;
+        }
+        os << "\n]\n";
+    }
+
+private:
+    zone_registry() = default;
+
+    friend class impl::zone_accumulator;
+
+    auto attach(const impl::zone_accumulator* accumulator) -> void {
+        const std::scoped_lock lock{m_mutex};
+        m_live.push_back(accumulator);
+    }
+
+    auto detach(const impl::zone_accumulator* accumulator) -> void {
+        const std::scoped_lock lock{m_mutex};
+        merge_into(m_retired, accumulator->snapshot());
+        std::erase(m_live, accumulator);
+    }
+
+    static auto merge_into(std::map<std::string_view, zone_stats>& merged,
+                           const zone_stats& stats) -> void {
+        if (stats.count == 0) {
+            return;
+        }
+        const auto [it, inserted]{merged.try_emplace(stats.name, stats)};
+        if (not inserted) {
+            it->second.merge(stats);
+        }
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<const impl::zone_accumulator*> m_live;
+    std::map<std::string_view, zone_stats> m_retired;
+};
+
+inline impl::zone_accumulator::zone_accumulator(std::string_view name) :
+    m_name{name} {
+    zone_registry::instance().attach(this);
+}
+
+inline impl::zone_accumulator::~zone_accumulator() {
+    zone_registry::instance().detach(this);
+}
+
+} // namespace muc::chrono
@@ -0,0 +1,124 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/common/inline_macro.h++"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace muc::impl {
+
+/// @brief Width (in bytes) of the widest vector registers enabled at compile
+/// time. Build with e.g. `-mavx2`, `-mavx512f` or `-march=native` to get wider
+/// kernels; SSE2 (x86-64) and NEON (AArch64) are always available.
+inline constexpr std::size_t simd_bytes{
+#if defined __AVX512F__
+    64
+#elif defined __AVX2__
+    32
+#else
+    16
+#endif
+};
+
+/// @brief Number of T lanes in one vector register.
+template<typename T>
+inline constexpr std::size_t simd_lanes{simd_bytes / sizeof(T)};
+
+/// @brief Broadcast a scalar to X, which is either T or a vector of T.
+template<typename X, typename T>
+MUC_ALWAYS_INLINE constexpr auto splat(T v) -> X {
+    if constexpr (std::is_same_v<X, T> or std::is_arithmetic_v<X>) {
+        return v;
+    } else {
+        X x;
+        for (std::size_t i{}; i < sizeof(X) / sizeof(T); ++i) {
+            x[i] = v;
+        }
+        return x;
+    }
+}
+
+#if defined __GNUC__ // GCC and Clang vector extensions
+
+/// @brief Portable SIMD vector of N lanes of T. The compiler maps it onto
+/// SSE2/AVX2/AVX-512/NEON registers as enabled by the target flags.
+template<typename T, std::size_t N>
+using simd_vector [[gnu::vector_size(N * sizeof(T))]] = T;
+
+/// @brief Load the first n (<= N) lanes from p, the rest are zero.
+template<typename V, typename T>
+MUC_ALWAYS_INLINE auto simd_load(const T* p, std::size_t n) -> V {
+    V v{};
+    std::memcpy(&v, p, n * sizeof(T));
+    return v;
+}
+
+/// @brief Store the first n (<= N) lanes of v to p.
+template<typename V, typename T>
+MUC_ALWAYS_INLINE auto simd_store(T* p, const V& v, std::size_t n) -> void {
+    std::memcpy(p, &v, n * sizeof(T));
+}
+
+/// @brief Whether all lanes of mask m are set.
+template<typename M>
+MUC_ALWAYS_INLINE auto simd_all(const M& m) -> bool {
+    for (std::size_t i{}; i < sizeof(M) / sizeof(m[0]); ++i) {
+        if (not m[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Mask of the lanes past the first n.
+template<typename V>
+MUC_ALWAYS_INLINE auto simd_padding_mask(std::size_t n) {
+    auto m{V{} != V{}};
+    for (std::size_t i{n}; i < sizeof(V) / sizeof(V{}[0]); ++i) {
+        m[i] = -1;
+    }
+    return m;
+}
+
+/// @brief y[i] = f(x[i]) for i in [0, n), N lanes at a time. f maps
+/// simd_vector<T, N> to simd_vector<T, N>; the last partial vector is padded
+/// with zeros. y may be x.
+template<typename T, std::size_t N, typename F>
+MUC_ALWAYS_INLINE auto simd_transform(const T* x, T* y, std::size_t n, F&& f)
+    -> void {
+    using V = simd_vector<T, N>;
+    std::size_t i{};
+    for (; i + N <= n; i += N) {
+        simd_store(y + i, f(simd_load<V>(x + i, N)), N);
+    }
+    if (i < n) {
+        simd_store(y + i, f(simd_load<V>(x + i, n - i)), n - i);
+    }
+}
+
+#endif
+
+} // namespace muc::impl
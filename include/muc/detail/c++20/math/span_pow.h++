@@ -0,0 +1,102 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/c++17/math/constexpr_cmath.h++"
+#include "muc/detail/c++17/math/parity.h++"
+#include "muc/detail/c++17/math/pow.h++"
+#include "muc/detail/c++20/math/impl/simd_vector.h++"
+#include "muc/detail/common/inline_macro.h++"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace muc {
+
+namespace impl {
+
+#if defined __GNUC__
+
+/// @brief x^n of all lanes of x, with the same sequence of operations as the
+/// scalar muc::pow.
+template<typename V>
+MUC_ALWAYS_INLINE auto simd_pow(V x, int n) -> V {
+    auto z{V{} + 1};
+    for (auto m{muc::abs(n)}; m > 0; m /= 2) {
+        if (muc::odd(m)) {
+            z *= x;
+        }
+        x *= x;
+    }
+    if (n >= 0) {
+        return z;
+    } else {
+        return 1 / z;
+    }
+}
+
+#endif
+
+template<std::floating_point T>
+auto pow(std::span<const T> x, int n, std::span<T> y) -> void {
+    assert(y.size() == x.size());
+#if defined __GNUC__
+    simd_transform<T, simd_lanes<T>>(x.data(), y.data(), x.size(),
+                                     [n](auto v) { return simd_pow(v, n); });
+#else
+    for (std::size_t i{}; i < x.size(); ++i) {
+        y[i] = muc::pow(x[i], n);
+    }
+#endif
+}
+
+} // namespace impl
+
+/// @brief Batched double-precision exponentiation with integer exponent
+/// @param x Base values
+/// @param n Integer exponent, shared by all bases
+/// @param y Output x^n, of the same size as x
+/// @note Vectorized for the widest of SSE2/AVX2/AVX-512/NEON enabled at
+/// compile time. The operations are those of the scalar muc::pow, so results
+/// are bitwise identical to it (0 ulp). In-place operation (y being x) is
+/// allowed.
+inline auto pow(std::span<const double> x, int n, std::span<double> y)
+    -> void {
+    impl::pow<double>(x, n, y);
+}
+
+/// @brief Batched single-precision exponentiation with integer exponent
+/// @param x Base values
+/// @param n Integer exponent, shared by all bases
+/// @param y Output x^n, of the same size as x
+/// @note Vectorized for the widest of SSE2/AVX2/AVX-512/NEON enabled at
+/// compile time. The operations are those of the scalar muc::pow, so results
+/// are bitwise identical to it (0 ulp). In-place operation (y being x) is
+/// allowed.
+inline auto pow(std::span<const float> x, int n, std::span<float> y) -> void {
+    impl::pow<float>(x, n, y);
+}
+
+} // namespace muc
@@ -0,0 +1,100 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/c++20/mutex/impl/spin_backoff.h++"
+#include "muc/detail/common/cache_line_size.h++"
+#include "muc/detail/common/inline_macro.h++"
+
+#include <atomic>
+#include <cstdint>
+
+namespace muc {
+
+/// @brief A test-and-test-and-set spin mutex with exponential backoff.
+/// @details Waiters only read the lock word while it is held and back off
+///          exponentially between attempts, which keeps the cache line from
+///          bouncing between cores under contention. A waiter whose backoff
+///          budget runs out sleeps in `std::atomic::wait` until the owner
+///          releases the lock.
+/// @warning It is NOT fair - thread acquisition order is not guaranteed.
+class alignas(impl::cache_line_size) backoff_spin_mutex {
+public:
+    /// @brief Constructs the mutex in an unlocked state
+    constexpr backoff_spin_mutex() noexcept = default;
+
+    backoff_spin_mutex(const backoff_spin_mutex&) = delete;
+    backoff_spin_mutex& operator=(const backoff_spin_mutex&) = delete;
+
+    /// @brief Acquires the lock, spinning with backoff and then sleeping
+    MUC_ALWAYS_INLINE auto lock() noexcept -> void {
+        if (not try_lock()) [[unlikely]] {
+            lock_contended();
+        }
+    }
+
+    /// @brief Attempts to acquire the lock without blocking
+    /// @return true if lock was acquired, false if already locked
+    MUC_ALWAYS_INLINE auto try_lock() noexcept -> bool {
+        auto expected{unlocked};
+        return m_state.compare_exchange_strong(expected, locked,
+                                               std::memory_order::acquire,
+                                               std::memory_order::relaxed);
+    }
+
+    /// @brief Releases the lock, waking up a sleeping waiter if any
+    /// @pre Must be called by the current lock owner
+    MUC_ALWAYS_INLINE auto unlock() noexcept -> void {
+        if (m_state.exchange(unlocked, std::memory_order::release) ==
+            locked_with_sleepers) [[unlikely]] {
+            m_state.notify_one();
+        }
+    }
+
+private:
+    MUC_NOINLINE auto lock_contended() noexcept -> void {
+        impl::spin_backoff backoff;
+        do {
+            backoff.pause();
+            if (m_state.load(std::memory_order::relaxed) == unlocked and
+                try_lock()) {
+                return;
+            }
+        } while (not backoff.saturated());
+        // Sleep. The state is left marked as having sleepers since other
+        // threads may still be sleeping on it.
+        while (m_state.exchange(locked_with_sleepers,
+                                std::memory_order::acquire) != unlocked) {
+            m_state.wait(locked_with_sleepers, std::memory_order::relaxed);
+        }
+    }
+
+private:
+    static constexpr std::uint32_t unlocked{0};
+    static constexpr std::uint32_t locked{1};
+    static constexpr std::uint32_t locked_with_sleepers{2};
+
+    std::atomic<std::uint32_t> m_state{unlocked};
+};
+
+} // namespace muc
@@ -0,0 +1,169 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/c++17/utility/cpu_relax.h++"
+#include "muc/detail/common/cache_line_size.h++"
+#include "muc/detail/common/inline_macro.h++"
+
+#include <atomic>
+#include <utility>
+
+namespace muc {
+
+namespace impl {
+
+struct alignas(cache_line_size) clh_node {
+    std::atomic<bool> locked{};
+    clh_node* next_free{};
+};
+
+/// @brief Per-thread cache of free CLH queue nodes.
+/// @details A node enqueued by one thread is recycled by its successor, so
+///          nodes migrate between threads. Each thread keeps the nodes it
+///          currently owns and frees them on exit.
+class clh_node_cache {
+public:
+    clh_node_cache() = default;
+    clh_node_cache(const clh_node_cache&) = delete;
+    clh_node_cache& operator=(const clh_node_cache&) = delete;
+
+    ~clh_node_cache() {
+        while (m_head) {
+            delete std::exchange(m_head, m_head->next_free);
+        }
+    }
+
+    auto acquire() -> clh_node* {
+        if (m_head == nullptr) [[unlikely]] {
+            return new clh_node;
+        }
+        return std::exchange(m_head, m_head->next_free);
+    }
+
+    auto release(clh_node* node) noexcept -> void {
+        node->next_free = std::exchange(m_head, node);
+    }
+
+    static auto this_thread() noexcept -> clh_node_cache& {
+        thread_local clh_node_cache cache;
+        return cache;
+    }
+
+private:
+    clh_node* m_head{};
+};
+
+} // namespace impl
+
+/// @brief A FIFO-fair queue-based spin mutex (Craig, Landin and Hagersten).
+/// @details Waiters form an implicit queue, and each one spins on the node of
+///          its predecessor, which lives on its own cache line. A release
+///          therefore invalidates only the cache line of the next waiter,
+///          which makes it scale far better than `spin_mutex` and
+///          `ticket_spin_mutex` under heavy contention.
+///          Queue nodes are cached per thread, so only the first locks
+///          performed by a thread may allocate. The tail is reset to a node
+///          owned by the mutex when the queue empties, so the mutex never
+///          reads a node that another thread may have freed.
+/// @warning As with any fair spin lock, performance degrades badly when there
+///          are more waiting threads than cores.
+class alignas(impl::cache_line_size) clh_spin_mutex {
+public:
+    /// @brief Constructs the mutex in an unlocked state
+    clh_spin_mutex() noexcept :
+        m_tail{&m_unlocked} {}
+
+    clh_spin_mutex(const clh_spin_mutex&) = delete;
+    clh_spin_mutex& operator=(const clh_spin_mutex&) = delete;
+
+    /// @brief Acquires the lock once all previously queued threads released it
+    /// @throw std::bad_alloc if a queue node cannot be allocated
+    MUC_ALWAYS_INLINE auto lock() -> void {
+        const auto node{impl::clh_node_cache::this_thread().acquire()};
+        node->locked.store(true, std::memory_order::relaxed);
+        const auto predecessor{
+            m_tail.exchange(node, std::memory_order::acq_rel)};
+        while (predecessor->locked.load(std::memory_order::acquire)) {
+            cpu_relax();
+        }
+        m_owner.node = node;
+        m_owner.predecessor = predecessor;
+    }
+
+    /// @brief Attempts to acquire the lock without queueing behind a waiter
+    /// @details Succeeds only if the queue is empty, which is checked against
+    /// the node owned by the mutex, so that no other thread's node is read.
+    /// @return true if lock was acquired, false if already locked
+    /// @throw std::bad_alloc if a queue node cannot be allocated
+    MUC_ALWAYS_INLINE auto try_lock() -> bool {
+        if (m_tail.load(std::memory_order::relaxed) != &m_unlocked) {
+            return false;
+        }
+        auto& cache{impl::clh_node_cache::this_thread()};
+        const auto node{cache.acquire()};
+        node->locked.store(true, std::memory_order::relaxed);
+        auto expected{&m_unlocked};
+        if (not m_tail.compare_exchange_strong(expected, node,
+                                               std::memory_order::acquire,
+                                               std::memory_order::relaxed)) {
+            cache.release(node);
+            return false;
+        }
+        m_owner.node = node;
+        m_owner.predecessor = &m_unlocked;
+        return true;
+    }
+
+    /// @brief Releases the lock, handing it over to the next queued thread
+    /// @pre Must be called by the current lock owner
+    MUC_ALWAYS_INLINE auto unlock() noexcept -> void {
+        const auto [node, predecessor]{m_owner};
+        auto& cache{impl::clh_node_cache::this_thread()};
+        // With nobody queued, the mutex goes back to its own node and ours
+        // is not referenced anymore. Otherwise the successor takes it over.
+        auto expected{node};
+        if (m_tail.compare_exchange_strong(expected, &m_unlocked,
+                                           std::memory_order::release,
+                                           std::memory_order::relaxed)) {
+            cache.release(node);
+        } else {
+            node->locked.store(false, std::memory_order::release);
+        }
+        if (predecessor != &m_unlocked) {
+            cache.release(predecessor);
+        }
+    }
+
+private:
+    struct owner {
+        impl::clh_node* node;
+        impl::clh_node* predecessor;
+    };
+
+    std::atomic<impl::clh_node*> m_tail;
+    impl::clh_node m_unlocked; ///< the tail when nobody holds the lock
+    alignas(impl::cache_line_size) owner m_owner{}; ///< written by the owner
+};
+
+} // namespace muc
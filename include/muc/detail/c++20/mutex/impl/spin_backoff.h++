@@ -0,0 +1,57 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/c++17/utility/cpu_relax.h++"
+#include "muc/detail/common/inline_macro.h++"
+
+#include <cstdint>
+
+namespace muc::impl {
+
+/// @brief Exponential backoff for spin-wait loops.
+/// @details Each `pause()` spins `cpu_relax()` for the current budget and
+/// doubles it, up to `MaxSpins`. Backing off spreads the retries of contending
+/// threads in time and keeps them from hammering the lock's cache line.
+template<std::uint32_t MaxSpins = 1024>
+class spin_backoff {
+public:
+    MUC_ALWAYS_INLINE auto pause() noexcept -> void {
+        for (auto i{m_spins}; i != 0; --i) {
+            cpu_relax();
+        }
+        if (m_spins < MaxSpins) {
+            m_spins *= 2;
+        }
+    }
+
+    /// @brief Whether the maximum spin budget has been reached
+    MUC_ALWAYS_INLINE auto saturated() const noexcept -> bool {
+        return m_spins >= MaxSpins;
+    }
+
+private:
+    std::uint32_t m_spins{1};
+};
+
+} // namespace muc::impl
@@ -0,0 +1,115 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/c++20/mutex/impl/spin_backoff.h++"
+#include "muc/detail/common/cache_line_size.h++"
+#include "muc/detail/common/inline_macro.h++"
+
+#include <atomic>
+#include <cstdint>
+
+namespace muc {
+
+/// @brief A reader-writer spin mutex satisfying `SharedLockable`.
+/// @details Any number of readers may hold the lock in shared mode, or a
+///          single writer in exclusive mode. A waiting writer keeps new
+///          readers out, so that writers are not starved by a continuous
+///          stream of readers. Waiters back off exponentially.
+/// @warning It is NOT fair - thread acquisition order is not guaranteed.
+class alignas(impl::cache_line_size) shared_spin_mutex {
+public:
+    /// @brief Constructs the mutex in an unlocked state
+    constexpr shared_spin_mutex() noexcept = default;
+
+    shared_spin_mutex(const shared_spin_mutex&) = delete;
+    shared_spin_mutex& operator=(const shared_spin_mutex&) = delete;
+
+    /// @brief Acquires the lock in exclusive mode
+    MUC_ALWAYS_INLINE auto lock() noexcept -> void {
+        impl::spin_backoff backoff;
+        while (true) {
+            auto state{m_state.load(std::memory_order::relaxed)};
+            if ((state & ~writer_waiting) == 0) {
+                // clears writer_waiting, other waiting writers set it again
+                if (m_state.compare_exchange_weak(state, writer,
+                                                  std::memory_order::acquire,
+                                                  std::memory_order::relaxed)) {
+                    return;
+                }
+            } else if ((state & writer_waiting) == 0) {
+                m_state.fetch_or(writer_waiting, std::memory_order::relaxed);
+            }
+            backoff.pause();
+        }
+    }
+
+    /// @brief Attempts to acquire the lock in exclusive mode without blocking
+    /// @return true if lock was acquired, false if already locked
+    MUC_ALWAYS_INLINE auto try_lock() noexcept -> bool {
+        auto state{m_state.load(std::memory_order::relaxed)};
+        return (state & ~writer_waiting) == 0 and
+               m_state.compare_exchange_strong(state, writer,
+                                               std::memory_order::acquire,
+                                               std::memory_order::relaxed);
+    }
+
+    /// @brief Releases the lock held in exclusive mode
+    /// @pre Must be called by the current exclusive lock owner
+    MUC_ALWAYS_INLINE auto unlock() noexcept -> void {
+        m_state.fetch_and(~writer, std::memory_order::release);
+    }
+
+    /// @brief Acquires the lock in shared mode
+    MUC_ALWAYS_INLINE auto lock_shared() noexcept -> void {
+        impl::spin_backoff backoff;
+        while (not try_lock_shared()) {
+            backoff.pause();
+        }
+    }
+
+    /// @brief Attempts to acquire the lock in shared mode without blocking
+    /// @return true if lock was acquired, false if held or awaited by a writer
+    MUC_ALWAYS_INLINE auto try_lock_shared() noexcept -> bool {
+        auto state{m_state.load(std::memory_order::relaxed)};
+        return (state & (writer | writer_waiting)) == 0 and
+               m_state.compare_exchange_strong(state, state + 1,
+                                               std::memory_order::acquire,
+                                               std::memory_order::relaxed);
+    }
+
+    /// @brief Releases the lock held in shared mode
+    /// @pre Must be called by a current shared lock owner
+    MUC_ALWAYS_INLINE auto unlock_shared() noexcept -> void {
+        m_state.fetch_sub(1, std::memory_order::release);
+    }
+
+private:
+    static constexpr std::uint32_t writer{1u << 31};
+    static constexpr std::uint32_t writer_waiting{1u << 30};
+
+    /// writer bit, writer waiting bit and reader count
+    std::atomic<std::uint32_t> m_state{};
+};
+
+} // namespace muc
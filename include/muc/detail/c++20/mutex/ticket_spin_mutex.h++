@@ -0,0 +1,82 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/c++17/utility/cpu_relax.h++"
+#include "muc/detail/common/cache_line_size.h++"
+#include "muc/detail/common/inline_macro.h++"
+
+#include <atomic>
+#include <cstdint>
+
+namespace muc {
+
+/// @brief A FIFO-fair spin mutex based on tickets.
+/// @details Each thread draws a ticket and waits until it is served, so the
+///          lock is granted in arrival order. Waiters back off in proportion
+///          to their distance from the head of the queue.
+/// @warning As with any fair spin lock, performance degrades badly when there
+///          are more waiting threads than cores.
+class alignas(impl::cache_line_size) ticket_spin_mutex {
+public:
+    /// @brief Constructs the mutex in an unlocked state
+    constexpr ticket_spin_mutex() noexcept = default;
+
+    ticket_spin_mutex(const ticket_spin_mutex&) = delete;
+    ticket_spin_mutex& operator=(const ticket_spin_mutex&) = delete;
+
+    /// @brief Acquires the lock once the ticket of the calling thread is served
+    MUC_ALWAYS_INLINE auto lock() noexcept -> void {
+        const auto ticket{m_next.fetch_add(1, std::memory_order::relaxed)};
+        while (true) {
+            const auto serving{m_serving.load(std::memory_order::acquire)};
+            if (serving == ticket) [[likely]] {
+                return;
+            }
+            for (auto i{ticket - serving}; i != 0; --i) {
+                cpu_relax();
+            }
+        }
+    }
+
+    /// @brief Attempts to acquire the lock without blocking
+    /// @return true if lock was acquired, false if already locked
+    MUC_ALWAYS_INLINE auto try_lock() noexcept -> bool {
+        auto serving{m_serving.load(std::memory_order::acquire)};
+        return m_next.compare_exchange_strong(serving, serving + 1,
+                                              std::memory_order::relaxed);
+    }
+
+    /// @brief Releases the lock, serving the next ticket
+    /// @pre Must be called by the current lock owner
+    MUC_ALWAYS_INLINE auto unlock() noexcept -> void {
+        m_serving.store(m_serving.load(std::memory_order::relaxed) + 1,
+                        std::memory_order::release);
+    }
+
+private:
+    std::atomic<std::uint32_t> m_next{};    ///< next ticket to be drawn
+    std::atomic<std::uint32_t> m_serving{}; ///< ticket of the lock owner
+};
+
+} // namespace muc
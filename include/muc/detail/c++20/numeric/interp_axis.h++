@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace muc {
+
+/// @brief An axis of a regular grid, with uniform or non-uniform knots.
+/// @details `locate(x)` finds the grid cell containing x and the position of x
+/// in it. It is O(1) on a uniform axis, and a branchless binary search on a
+/// non-uniform one. Points outside the axis are located in the first or last
+/// cell, so that interpolation extrapolates linearly.
+/// @tparam U The coordinate type
+template<std::floating_point U>
+class interp_axis {
+public:
+    using value_type = U;
+
+public:
+    /// @brief Constructs a uniform axis of n knots from min to max
+    /// @pre n >= 2 and min < max
+    interp_axis(U min, U max, std::size_t n) :
+        m_knot{},
+        m_inv_width{},
+        m_min{min},
+        m_max{max},
+        m_inv_dx{(n - 1) / (max - min)},
+        m_size{n} {
+        assert(n >= 2 and min < max);
+    }
+
+    /// @brief Constructs a non-uniform axis from its knots
+    /// @pre knot has at least 2 elements and is strictly increasing
+    interp_axis(std::vector<U> knot) :
+        m_knot{std::move(knot)},
+        m_inv_width(m_knot.size() - 1),
+        m_min{m_knot.front()},
+        m_max{m_knot.back()},
+        m_inv_dx{},
+        m_size{m_knot.size()} {
+        assert(m_size >= 2);
+        for (std::size_t i{}; i < m_size - 1; ++i) {
+            assert(m_knot[i] < m_knot[i + 1]);
+            m_inv_width[i] = 1 / (m_knot[i + 1] - m_knot[i]);
+        }
+    }
+
+    /// @brief Number of knots
+    auto size() const -> std::size_t {
+        return m_size;
+    }
+
+    auto uniform() const -> bool {
+        return m_knot.empty();
+    }
+
+    auto min() const -> U {
+        return m_min;
+    }
+
+    auto max() const -> U {
+        return m_max;
+    }
+
+    /// @brief The i-th knot
+    auto knot(std::size_t i) const -> U {
+        if (not uniform()) {
+            return m_knot[i];
+        }
+        return i == m_size - 1 ? m_max :
+                                m_min + i * (m_max - m_min) / (m_size - 1);
+    }
+
+    /// @brief Locates x on the axis.
+    /// @return The cell index i in [0, size() - 2] and the interpolation
+    /// parameter t, so that x = (1 - t) * knot(i) + t * knot(i + 1). t is
+    /// outside [0, 1] if x is outside the axis, and NaN if x is NaN.
+    auto locate(U x) const -> std::pair<std::size_t, U> {
+        if (uniform()) {
+            const auto s{(x - m_min) * m_inv_dx};
+            const auto last{static_cast<U>(m_size - 2)};
+            // Comparisons are false for NaN, which goes to the first cell
+            const auto cell{s >= 0 ? (s < last ? s : last) : U{}};
+            const auto i{static_cast<std::size_t>(cell)};
+            return {i, s - i};
+        }
+        const auto first{m_knot.data()};
+        auto base{first};
+        for (auto n{m_size - 1}; n > 1;) {
+            const auto half{n / 2};
+            base = base[half] <= x ? base + half : base;
+            n -= half;
+        }
+        const auto i{static_cast<std::size_t>(base - first)};
+        return {i, (x - *base) * m_inv_width[i]};
+    }
+
+private:
+    std::vector<U> m_knot;      ///< empty if uniform
+    std::vector<U> m_inv_width; ///< of each cell, empty if uniform
+    U m_min;
+    U m_max;
+    U m_inv_dx; ///< if uniform
+    std::size_t m_size;
+};
+
+} // namespace muc
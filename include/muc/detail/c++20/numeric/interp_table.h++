@@ -0,0 +1,282 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/c++17/memory/impl/aligned_allocator.h++"
+#include "muc/detail/c++17/numeric/bilerp.h++"
+#include "muc/detail/c++17/numeric/lerp.h++"
+#include "muc/detail/c++17/numeric/trilerp.h++"
+#include "muc/detail/c++20/concepts/general_arithmetic.h++"
+#include "muc/detail/c++20/numeric/interp_axis.h++"
+#include "muc/detail/common/cache_line_size.h++"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace muc {
+
+/// @brief Multilinear interpolation table on a 1D, 2D or 3D regular grid.
+/// @details Values are stored in tiles of 4 knots along each axis, in Morton
+/// order inside a tile, and the storage is aligned to a cache line. The
+/// corners of a cell are thus close in memory (contiguous for cells at even
+/// positions in their tile, in the same or the neighbouring tile otherwise),
+/// where in a row-major grid they are a whole row or plane apart. The grid is
+/// only padded to a multiple of 4 knots along each axis. Per-axis tables map
+/// knot indices to offsets, so that locating the corners costs about as much
+/// as in a row-major grid.
+///
+/// Only the batch operator() is faster than a row-major grid: it overlaps the
+/// cache misses of consecutive lookups, which makes random lookups in a 160^3
+/// field map about 1.4 times faster. Single lookups are bound by the latency
+/// of a cache miss and cost about as much as in a row-major grid, up to 10%
+/// more when the grid is in cache. Coherent lookups, such as along a
+/// particle track, hit the cache and leave no misses to overlap: the batch
+/// then only adds a pass, and is 10 to 30% slower than a loop over a
+/// row-major grid.
+///
+/// Interpolation is done by `lerp`, `bilerp` or `trilerp`. Outside the grid,
+/// values are extrapolated linearly from the closest cell.
+/// @tparam T The value type, can be a scalar or vector or something.
+/// @tparam Dim The number of dimensions, 1, 2 or 3
+/// @tparam U The coordinate type
+template<general_arithmetic T, std::size_t Dim, std::floating_point U = double>
+    requires(Dim >= 1 and Dim <= 3)
+class interp_table {
+public:
+    using value_type = T;
+    using coordinate_type = U;
+    using point_type = std::array<U, Dim>;
+    using index_type = std::array<std::size_t, Dim>;
+
+public:
+    /// @brief Constructs a table from the values at the knots
+    /// @param axis The axes of the grid
+    /// @param value The values at the knots in row-major order (i.e. the index
+    /// along the last axis varies fastest)
+    interp_table(std::array<interp_axis<U>, Dim> axis,
+                 std::span<const T> value) :
+        m_axis{std::move(axis)},
+        m_offset{},
+        m_value{} {
+        allocate();
+        assert(value.size() == size());
+        for_each_knot([&](const index_type& i, std::size_t k) {
+            set(i, value[k]);
+        });
+    }
+
+    /// @brief Constructs a table by evaluating f at the knots
+    /// @param axis The axes of the grid
+    /// @param f The function to tabulate, called as f(point_type)
+    template<std::invocable<const point_type&> F>
+    interp_table(std::array<interp_axis<U>, Dim> axis, F&& f) :
+        m_axis{std::move(axis)},
+        m_offset{},
+        m_value{} {
+        allocate();
+        for_each_knot([&](const index_type& i, std::size_t) {
+            point_type x;
+            for (std::size_t d{}; d < Dim; ++d) {
+                x[d] = m_axis[d].knot(i[d]);
+            }
+            set(i, std::invoke(f, std::as_const(x)));
+        });
+    }
+
+    auto axis(std::size_t d) const -> const interp_axis<U>& {
+        return m_axis[d];
+    }
+
+    /// @brief Total number of knots
+    auto size() const -> std::size_t {
+        std::size_t n{1};
+        for (auto&& a : m_axis) {
+            n *= a.size();
+        }
+        return n;
+    }
+
+    /// @brief The value at knot i
+    auto at(const index_type& i) const -> const T& {
+        return m_value[offset(i)];
+    }
+
+    /// @brief Interpolates the table at point x
+    auto operator()(const point_type& x) const -> T {
+        return interpolate(locate(x));
+    }
+
+    /// @brief Interpolates the table at point (x...)
+    template<std::floating_point... Us>
+        requires(sizeof...(Us) == Dim)
+    auto operator()(Us... x) const -> T {
+        return (*this)(point_type{static_cast<U>(x)...});
+    }
+
+    /// @brief Interpolates the table at a batch of points.
+    /// @details Points are located a few at a time, and the corners of their
+    /// cells prefetched before being interpolated, so that the cache misses of
+    /// consecutive lookups overlap. Each value is the same as the one of the
+    /// scalar operator(). This only pays off for scattered points: when
+    /// consecutive points share cells, prefer a loop over the scalar
+    /// operator().
+    /// @param x The points
+    /// @param value Output interpolated values, of the same size as x
+    auto operator()(std::span<const point_type> x, std::span<T> value) const
+        -> void {
+        assert(value.size() == x.size());
+        constexpr std::size_t batch{16};
+        std::array<located, batch> cell;
+        for (std::size_t i{}; i < x.size(); i += batch) {
+            const auto n{std::min(batch, x.size() - i)};
+            for (std::size_t j{}; j < n; ++j) {
+                cell[j] = locate(x[i + j]);
+#if defined __GNUC__
+                __builtin_prefetch(&corner(cell[j], 0));
+                __builtin_prefetch(&corner(cell[j], n_corner - 1));
+#endif
+            }
+            for (std::size_t j{}; j < n; ++j) {
+                value[i + j] = interpolate(cell[j]);
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t tile_knots{4};
+    static constexpr std::size_t tile_size{std::size_t{1} << (2 * Dim)};
+    static constexpr std::size_t n_corner{std::size_t{1} << Dim};
+
+    struct located {
+        /// Offsets of the lower and upper knots of the cell along each axis
+        std::array<std::array<std::size_t, 2>, Dim> offset;
+        point_type t;
+    };
+
+    /// @brief Morton code of the local knot index along each axis. Bits of
+    /// different axes are interleaved, so codes are summed axis by axis.
+    static constexpr auto morton_code{[] {
+        std::array<std::array<std::size_t, tile_knots>, Dim> code{};
+        for (std::size_t d{}; d < Dim; ++d) {
+            for (std::size_t r{}; r < tile_knots; ++r) {
+                code[d][r] = (r & 1) << d | (r >> 1) << (Dim + d);
+            }
+        }
+        return code;
+    }()};
+
+    auto allocate() -> void {
+        std::size_t n{1};
+        for (auto d{Dim}; d-- > 0;) {
+            m_offset[d].resize(m_axis[d].size());
+            for (std::size_t k{}; k < m_offset[d].size(); ++k) {
+                const auto q{k / tile_knots};
+                m_offset[d][k] =
+                    q * n * tile_size + morton_code[d][k - q * tile_knots];
+            }
+            n *= (m_axis[d].size() + tile_knots - 1) / tile_knots;
+        }
+        m_value.resize(n * tile_size);
+    }
+
+    /// @brief Calls f(knot index, row-major offset) for all knots
+    template<typename F>
+    auto for_each_knot(F&& f) const -> void {
+        index_type i{};
+        for (std::size_t k{}; k < size(); ++k) {
+            f(std::as_const(i), k);
+            for (auto d{Dim}; d-- > 0;) {
+                if (++i[d] < m_axis[d].size()) {
+                    break;
+                }
+                i[d] = 0;
+            }
+        }
+    }
+
+    /// @brief Offset of knot i in m_value
+    auto offset(const index_type& i) const -> std::size_t {
+        std::size_t offset{};
+        for (std::size_t d{}; d < Dim; ++d) {
+            offset += m_offset[d][i[d]];
+        }
+        return offset;
+    }
+
+    auto set(const index_type& i, const T& value) -> void {
+        m_value[offset(i)] = value;
+    }
+
+    auto locate(const point_type& x) const -> located {
+        located cell;
+        for (std::size_t d{}; d < Dim; ++d) {
+            const auto [i, t]{m_axis[d].locate(x[d])};
+            cell.offset[d] = {m_offset[d][i], m_offset[d][i + 1]};
+            cell.t[d] = t;
+        }
+        return cell;
+    }
+
+    /// @brief Corner c of a located cell, bit d of c being the side along
+    /// axis d
+    auto corner(const located& cell, std::size_t c) const -> const T& {
+        std::size_t offset{};
+        for (std::size_t d{}; d < Dim; ++d) {
+            offset += cell.offset[d][c >> d & 1];
+        }
+        return m_value[offset];
+    }
+
+    auto interpolate(const located& cell) const -> T {
+        const auto c{[&](std::size_t i) -> const T& {
+            return corner(cell, i);
+        }};
+        const auto& t{cell.t};
+        if constexpr (Dim == 1) {
+            return muc::lerp(c(0), c(1), t[0]);
+        } else if constexpr (Dim == 2) {
+            return muc::bilerp(c(0b00), c(0b10), c(0b01), c(0b11), t[0], t[1]);
+        } else {
+            return muc::trilerp(c(0b000), c(0b100), c(0b010), c(0b110),
+                                c(0b001), c(0b101), c(0b011), c(0b111), t[0],
+                                t[1], t[2]);
+        }
+    }
+
+private:
+    std::array<interp_axis<U>, Dim> m_axis;
+    /// Offsets of the knots along each axis, summed over axes to address a
+    /// knot in m_value
+    std::array<std::vector<std::size_t>, Dim> m_offset;
+    /// Tiles of tile_size knots, the first one aligned to a cache line
+    std::vector<T, impl::aligned_allocator<T, impl::cache_line_size>> m_value;
+};
+
+} // namespace muc
@@ -22,10 +22,17 @@
 
 #pragma once
 
+#include "muc/detail/c++20/math/impl/simd_vector.h++"
+#include "muc/detail/common/inline_macro.h++"
+
+#include <algorithm>
+#include <cassert>
 #include <concepts>
 #include <initializer_list>
 #include <limits>
 #include <ranges>
+#include <span>
+#include <type_traits>
 
 namespace muc {
 
@@ -52,18 +59,22 @@ namespace muc {
 /// @return The result of evaluating the polynomial at the point `x`.
 ///         If the coefficients are empty, returns NaN or 0 depending on the
 ///         type.
+/// @note The sum is accumulated in the common type of `T` and the
+/// coefficients (double for float `x` with double coefficients) and rounded
+/// to `T` once, at the end.
 template<std::floating_point T, std::ranges::range C = std::initializer_list<T>>
 constexpr auto polynomial(C&& coeff, T x) -> T {
+    using U = std::common_type_t<T, std::ranges::range_value_t<C>>;
     auto c{std::ranges::crbegin(coeff)};
     const auto end{std::ranges::crend(coeff)};
     if (c == end) {
         return std::numeric_limits<T>::quiet_NaN();
     }
-    T p{*c++};
+    auto p{static_cast<U>(*c++)};
     while (c != end) {
         p = p * x + *c++;
     }
-    return p;
+    return static_cast<T>(p);
 }
 
 /// @brief Evaluates a polynomial at a given integral value using Horner's
@@ -95,4 +106,159 @@ constexpr auto polynomial(C&& coeff, std::integral auto x) -> T {
     return polynomial<T>(coeff, x);
 }
 
+namespace impl {
+
+/// @brief Type in which `polynomial(coeff, x)` accumulates for x of type T.
+template<typename T, typename C>
+using horner_type = std::common_type_t<T, std::ranges::range_value_t<C>>;
+
+/// @brief Whether polynomials with coefficients C at x of type T can be
+/// evaluated in SIMD vectors (which exist for float and double only).
+template<typename T, typename C>
+constexpr bool simd_horner{std::same_as<horner_type<T, C>, float> or
+                           std::same_as<horner_type<T, C>, double>};
+
+/// @brief Horner's method over a range of coefficients (converted to T), for
+/// x of type T or a SIMD vector of T. The coefficients must not be empty.
+template<typename T, typename X, std::ranges::range C>
+MUC_ALWAYS_INLINE constexpr auto horner(const C& coeff, X x) -> X {
+    auto c{std::ranges::crbegin(coeff)};
+    const auto end{std::ranges::crend(coeff)};
+    auto p{splat<X>(static_cast<T>(*c++))};
+    while (c != end) {
+        p = p * x + static_cast<T>(*c++);
+    }
+    return p;
+}
+
+#if defined __GNUC__
+
+/// @brief Horner's method for a SIMD vector x of T, accumulated in
+/// `horner_type<T, C>` and rounded back to T, as `polynomial(coeff, x[i])`
+/// does lane by lane.
+template<typename T, typename X, std::ranges::range C>
+    requires simd_horner<T, C>
+MUC_ALWAYS_INLINE auto horner_as(const C& coeff, X x) -> X {
+    using U = horner_type<T, C>;
+    if constexpr (std::same_as<U, T>) {
+        return impl::horner<T>(coeff, x);
+    } else {
+        // Inline rather than through horner<U>: W is wider than a register
+        // and must not be passed by value.
+        using W = simd_vector<U, sizeof(X) / sizeof(T)>;
+        const auto w{__builtin_convertvector(x, W)};
+        auto c{std::ranges::crbegin(coeff)};
+        const auto end{std::ranges::crend(coeff)};
+        auto p{W{} + static_cast<U>(*c++)};
+        while (c != end) {
+            p = p * w + static_cast<U>(*c++);
+        }
+        return __builtin_convertvector(p, X);
+    }
+}
+
+#endif
+
+template<std::floating_point T, std::ranges::range C>
+auto polynomial(const C& coeff, std::span<const T> x, std::span<T> y)
+    -> void {
+    assert(y.size() == x.size());
+    if (std::ranges::empty(coeff)) {
+        std::ranges::fill(y, std::numeric_limits<T>::quiet_NaN());
+        return;
+    }
+    std::size_t i{};
+#if defined __GNUC__
+    if constexpr (std::same_as<horner_type<T, C>, T>) {
+        // One Horner chain per vector is latency bound, and the coefficients
+        // are reloaded at every step: advance four independent chains
+        // together.
+        using V = simd_vector<T, simd_lanes<T>>;
+        constexpr auto n{simd_lanes<T>};
+        for (; i + 4 * n <= x.size(); i += 4 * n) {
+            const auto x0{simd_load<V>(x.data() + i, n)};
+            const auto x1{simd_load<V>(x.data() + i + n, n)};
+            const auto x2{simd_load<V>(x.data() + i + 2 * n, n)};
+            const auto x3{simd_load<V>(x.data() + i + 3 * n, n)};
+            auto c{std::ranges::crbegin(coeff)};
+            const auto end{std::ranges::crend(coeff)};
+            auto p0{splat<V>(static_cast<T>(*c++))};
+            auto p1{p0};
+            auto p2{p0};
+            auto p3{p0};
+            while (c != end) {
+                const auto a{static_cast<T>(*c++)};
+                p0 = p0 * x0 + a;
+                p1 = p1 * x1 + a;
+                p2 = p2 * x2 + a;
+                p3 = p3 * x3 + a;
+            }
+            simd_store(y.data() + i, p0, n);
+            simd_store(y.data() + i + n, p1, n);
+            simd_store(y.data() + i + 2 * n, p2, n);
+            simd_store(y.data() + i + 3 * n, p3, n);
+        }
+    }
+    if constexpr (simd_horner<T, C>) {
+        simd_transform<T, simd_lanes<T>>(
+            x.data() + i, y.data() + i, x.size() - i,
+            [&](auto v) { return impl::horner_as<T>(coeff, v); });
+        return;
+    }
+#endif
+    for (; i < x.size(); ++i) {
+        y[i] = muc::polynomial(coeff, x[i]);
+    }
+}
+
+} // namespace impl
+
+/// @brief Evaluates a polynomial at a batch of values using Qin Jiushao's
+/// method.
+///
+/// Same as evaluating `polynomial(coeff, x[i])` for each i (and giving the
+/// same results), but vectorized across x for the widest of
+/// SSE2/AVX2/AVX-512/NEON enabled at compile time. This pays off for
+/// coefficients known only at run time: a loop over the scalar function is
+/// not vectorized then. When the coefficients are compile-time constants,
+/// -O3 vectorizes such a loop just as well and the two are on par.
+///
+/// @tparam C The type of the coefficients collection, which defaults to an
+/// initializer_list. It must satisfy the requirements of a range.
+/// @param coeff A collection of coefficients representing the polynomial,
+/// starting from the constant term.
+/// @param x The values at which the polynomial is to be evaluated.
+/// @param y Output values, of the same size as `x`. `y` may be `x`. Filled
+/// with NaN if the coefficients are empty.
+template<std::ranges::range C = std::initializer_list<double>>
+auto polynomial(C&& coeff, std::span<const double> x, std::span<double> y)
+    -> void {
+    impl::polynomial<double>(coeff, x, y);
+}
+
+/// @brief Evaluates a polynomial at a batch of values using Qin Jiushao's
+/// method.
+///
+/// Same as evaluating `polynomial(coeff, x[i])` for each i (and giving the
+/// same results), but vectorized across x for the widest of
+/// SSE2/AVX2/AVX-512/NEON enabled at compile time. This pays off for
+/// coefficients known only at run time: a loop over the scalar function is
+/// not vectorized then. When the coefficients are compile-time constants,
+/// -O3 vectorizes such a loop just as well and the two are on par.
+/// Double coefficients are evaluated in double lanes, as the scalar
+/// function accumulates in double, at half the float throughput.
+///
+/// @tparam C The type of the coefficients collection, which defaults to an
+/// initializer_list. It must satisfy the requirements of a range.
+/// @param coeff A collection of coefficients representing the polynomial,
+/// starting from the constant term.
+/// @param x The values at which the polynomial is to be evaluated.
+/// @param y Output values, of the same size as `x`. `y` may be `x`. Filled
+/// with NaN if the coefficients are empty.
+template<std::ranges::range C = std::initializer_list<float>>
+auto polynomial(C&& coeff, std::span<const float> x, std::span<float> y)
+    -> void {
+    impl::polynomial<float>(coeff, x, y);
+}
+
 } // namespace muc
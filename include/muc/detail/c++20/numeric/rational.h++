@@ -22,11 +22,16 @@
 
 #pragma once
 
+#include "muc/detail/c++20/math/impl/simd_vector.h++"
 #include "muc/detail/c++20/numeric/polynomial.h++"
 
+#include <algorithm>
+#include <cassert>
 #include <concepts>
 #include <initializer_list>
+#include <limits>
 #include <ranges>
+#include <span>
 
 namespace muc {
 
@@ -106,4 +111,77 @@ constexpr auto rational(A&& numer, B&& denom, std::integral auto x) -> T {
     return rational<T>(numer, denom, x);
 }
 
+namespace impl {
+
+template<std::floating_point T, std::ranges::range A, std::ranges::range B>
+auto rational(const A& numer, const B& denom, std::span<const T> x,
+              std::span<T> y) -> void {
+    assert(y.size() == x.size());
+    if (std::ranges::empty(numer) or std::ranges::empty(denom)) {
+        std::ranges::fill(y, std::numeric_limits<T>::quiet_NaN());
+        return;
+    }
+#if defined __GNUC__
+    if constexpr (simd_horner<T, A> and simd_horner<T, B>) {
+        simd_transform<T, simd_lanes<T>>(
+            x.data(), y.data(), x.size(), [&](auto v) {
+                return impl::horner_as<T>(numer, v) /
+                       impl::horner_as<T>(denom, v);
+            });
+        return;
+    }
+#endif
+    for (std::size_t i{}; i < x.size(); ++i) {
+        y[i] = muc::rational(numer, denom, x[i]);
+    }
+}
+
+} // namespace impl
+
+/// @brief Evaluates a rational function at a batch of values.
+///
+/// Same as evaluating `rational(numer, denom, x[i])` for each i (and giving
+/// the same results), but vectorized across x for the widest of
+/// SSE2/AVX2/AVX-512/NEON enabled at compile time.
+///
+/// @tparam A The type of the coefficients collection for the numerator.
+/// @tparam B The type of the coefficients collection for the denominator.
+/// @param numer Coefficients of the numerator, starting from the constant
+/// term.
+/// @param denom Coefficients of the denominator, starting from the constant
+/// term.
+/// @param x The values at which the rational function is to be evaluated.
+/// @param y Output values, of the same size as `x`. `y` may be `x`.
+///         Note: The function does not check for division by zero.
+template<std::ranges::range A = std::initializer_list<double>,
+         std::ranges::range B = std::initializer_list<double>>
+auto rational(A&& numer, B&& denom, std::span<const double> x,
+              std::span<double> y) -> void {
+    impl::rational<double>(numer, denom, x, y);
+}
+
+/// @brief Evaluates a rational function at a batch of values.
+///
+/// Same as evaluating `rational(numer, denom, x[i])` for each i (and giving
+/// the same results), but vectorized across x for the widest of
+/// SSE2/AVX2/AVX-512/NEON enabled at compile time. Double coefficients
+/// are evaluated in double lanes, as the scalar function accumulates in
+/// double.
+///
+/// @tparam A The type of the coefficients collection for the numerator.
+/// @tparam B The type of the coefficients collection for the denominator.
+/// @param numer Coefficients of the numerator, starting from the constant
+/// term.
+/// @param denom Coefficients of the denominator, starting from the constant
+/// term.
+/// @param x The values at which the rational function is to be evaluated.
+/// @param y Output values, of the same size as `x`. `y` may be `x`.
+///         Note: The function does not check for division by zero.
+template<std::ranges::range A = std::initializer_list<float>,
+         std::ranges::range B = std::initializer_list<float>>
+auto rational(A&& numer, B&& denom, std::span<const float> x,
+              std::span<float> y) -> void {
+    impl::rational<float>(numer, denom, x, y);
+}
+
 } // namespace muc
@@ -0,0 +1,264 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/c++20/ceta_string/ceta_string.h++"
+#include "muc/detail/c++20/math/impl/simd_vector.h++"
+#include "muc/detail/common/inline_macro.h++"
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace muc {
+
+namespace impl {
+
+template<typename>
+inline constexpr bool is_std_array{false};
+
+template<typename T, std::size_t N>
+inline constexpr bool is_std_array<std::array<T, N>>{true};
+
+/// @brief Coefficients of static_polynomial<C...> as a std::array, from
+/// either a list of values or a single std::array.
+template<auto... C>
+consteval auto make_static_coefficients() {
+    if constexpr (sizeof...(C) == 1 and
+                  (is_std_array<std::remove_cvref_t<decltype(C)>> and ...)) {
+        return (C, ...);
+    } else {
+        return std::array<std::common_type_t<decltype(C)...>, sizeof...(C)>{
+            C...};
+    }
+}
+
+/// @brief The std::array C with its elements converted to T.
+template<typename T, auto C>
+inline constexpr auto coefficients_as{[] {
+    std::array<T, C.size()> c;
+    for (std::size_t i{}; i < C.size(); ++i) {
+        c[i] = static_cast<T>(C[i]);
+    }
+    return c;
+}()};
+
+/// @brief Horner's method over the coefficients c[Offset], c[Offset +
+/// Stride], ..., with the recursion fully unrolled. Returns a scalar if there
+/// is only one such coefficient.
+template<std::size_t Offset, std::size_t Stride, typename T, std::size_t N,
+         typename X>
+MUC_ALWAYS_INLINE constexpr auto unrolled_horner(const std::array<T, N>& c,
+                                                 X x) {
+    constexpr auto n{(N - Offset + Stride - 1) / Stride};
+    if constexpr (n == 1) {
+        return c[Offset];
+    } else {
+        return [&]<std::size_t... I>(std::index_sequence<I...>) {
+            X p{c[Offset + (n - 1) * Stride] * x +
+                c[Offset + (n - 2) * Stride]};
+            ((p = p * x + c[Offset + (n - 3 - I) * Stride]), ...);
+            return p;
+        }(std::make_index_sequence<n - 2>{});
+    }
+}
+
+/// @brief Estrin's scheme: terms are paired as q[2i] + q[2i+1] x, then the
+/// pairs are combined with x^2, x^4, ... The tree has depth log2(N).
+template<typename X, typename Q, std::size_t M>
+MUC_ALWAYS_INLINE constexpr auto estrin(const std::array<Q, M>& q, X x) -> X {
+    if constexpr (M == 1) {
+        return splat<X>(q[0]);
+    } else if constexpr (M == 2) {
+        return q[0] + q[1] * x;
+    } else {
+        std::array<X, (M + 1) / 2> r{};
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            ((r[I] = q[2 * I] + q[2 * I + 1] * x), ...);
+        }(std::make_index_sequence<M / 2>{});
+        if constexpr (M % 2 == 1) {
+            r.back() = splat<X>(q.back());
+        }
+        return estrin<X>(r, x * x);
+    }
+}
+
+/// @brief Evaluate the polynomial with coefficients c (constant term first)
+/// at x, which is either a scalar or a simd_vector.
+/// @tparam Scheme "horner", "horner2" (second-order Horner: even and odd
+/// terms as two independent chains in x^2) or "estrin"
+template<ceta_string Scheme, typename X, typename T, std::size_t N>
+MUC_ALWAYS_INLINE constexpr auto evaluate_polynomial(const std::array<T, N>& c,
+                                                     X x) -> X {
+    if constexpr (N == 1) {
+        return splat<X>(c[0]);
+    } else if constexpr (Scheme == "horner") {
+        return unrolled_horner<0, 1>(c, x);
+    } else if constexpr (Scheme == "horner2") {
+        const X x2{x * x};
+        return unrolled_horner<0, 2>(c, x2) +
+               x * unrolled_horner<1, 2>(c, x2);
+    } else if constexpr (Scheme == "estrin") {
+        return estrin<X>(c, x);
+    }
+}
+
+} // namespace impl
+
+/// @brief Evaluates a polynomial with a fixed number of coefficients
+///
+/// The evaluation is fully unrolled at compile time. Horner's method has a
+/// dependency chain of N multiply-adds; "horner2" and "estrin" trade a few
+/// extra multiplications for shorter chains (N/2 and log2(N) respectively),
+/// which is faster for high degrees when latency, not throughput, bounds.
+/// The schemes may round differently in the last bits.
+///
+/// @tparam Scheme "horner", "horner2" or "estrin"
+/// @param coeff The coefficients, starting from the constant term
+/// @param x The value at which the polynomial is to be evaluated
+/// @return The result of evaluating the polynomial at the point `x`
+template<ceta_string Scheme, std::floating_point T, typename U, std::size_t N>
+    requires(Scheme == "horner" or Scheme == "horner2" or Scheme == "estrin")
+constexpr auto polynomial(const std::array<U, N>& coeff, T x) -> T {
+    static_assert(N > 0);
+    std::array<T, N> c;
+    for (std::size_t i{}; i < N; ++i) {
+        c[i] = static_cast<T>(coeff[i]);
+    }
+    return impl::evaluate_polynomial<Scheme>(c, x);
+}
+
+/// @brief A polynomial with compile-time coefficients
+///
+/// `static_polynomial<c0, c1, c2>` (or equivalently
+/// `static_polynomial<std::array{c0, c1, c2}>`) represents
+/// c0 + c1 x + c2 x^2. Evaluation is fully unrolled at compile time, with
+/// Horner's method by default for both scalars and batches, so that p(x) and
+/// p(xs, ys) agree exactly. Pass "estrin" explicitly for latency-bound scalar
+/// evaluation of high degrees.
+/// Batch evaluation is vectorized for the widest of SSE2/AVX2/AVX-512/NEON
+/// enabled at compile time.
+///
+/// @tparam C The coefficients, starting from the constant term
+template<auto... C>
+class static_polynomial {
+public:
+    /// @brief The coefficients, starting from the constant term
+    static constexpr auto coefficients{impl::make_static_coefficients<C...>()};
+    static_assert(coefficients.size() > 0);
+    /// @brief The degree of the polynomial
+    static constexpr std::size_t degree{coefficients.size() - 1};
+
+public:
+    /// @brief Evaluate at x
+    /// @tparam Scheme "horner", "horner2" or "estrin"
+    template<ceta_string Scheme = "horner", std::floating_point T>
+        requires(Scheme == "horner" or Scheme == "horner2" or
+                 Scheme == "estrin")
+    static constexpr auto evaluate(T x) -> T {
+        return impl::evaluate_polynomial<Scheme>(
+            impl::coefficients_as<T, coefficients>, x);
+    }
+
+    /// @brief Evaluate at a batch of x
+    /// @tparam Scheme "horner", "horner2" or "estrin"
+    /// @param x The values at which the polynomial is to be evaluated
+    /// @param y Output values, of the same size as x. y may be x.
+    template<ceta_string Scheme = "horner">
+        requires(Scheme == "horner" or Scheme == "horner2" or
+                 Scheme == "estrin")
+    static auto evaluate(std::span<const double> x, std::span<double> y)
+        -> void {
+        evaluate_batch<Scheme, double>(x, y);
+    }
+
+    /// @brief Evaluate at a batch of x
+    /// @tparam Scheme "horner", "horner2" or "estrin"
+    /// @param x The values at which the polynomial is to be evaluated
+    /// @param y Output values, of the same size as x. y may be x.
+    template<ceta_string Scheme = "horner">
+        requires(Scheme == "horner" or Scheme == "horner2" or
+                 Scheme == "estrin")
+    static auto evaluate(std::span<const float> x, std::span<float> y)
+        -> void {
+        evaluate_batch<Scheme, float>(x, y);
+    }
+
+    /// @brief Evaluate at x with the default scheme
+    template<std::floating_point T>
+    constexpr auto operator()(T x) const -> T {
+        return evaluate(x);
+    }
+
+    /// @brief Evaluate at x with the default scheme
+    template<std::floating_point T = double>
+    constexpr auto operator()(std::integral auto x) const -> T {
+        return evaluate(static_cast<T>(x));
+    }
+
+    /// @brief Evaluate at a batch of x with the default scheme
+    auto operator()(std::span<const double> x, std::span<double> y) const
+        -> void {
+        evaluate(x, y);
+    }
+
+    /// @brief Evaluate at a batch of x with the default scheme
+    auto operator()(std::span<const float> x, std::span<float> y) const
+        -> void {
+        evaluate(x, y);
+    }
+
+private:
+    template<ceta_string Scheme, typename T>
+    static auto evaluate_batch(std::span<const T> x, std::span<T> y) -> void {
+        assert(y.size() == x.size());
+#if defined __GNUC__
+        impl::simd_transform<T, impl::simd_lanes<T>>(
+            x.data(), y.data(), x.size(), [](auto v) {
+                return impl::evaluate_polynomial<Scheme>(
+                    impl::coefficients_as<T, coefficients>, v);
+            });
+#else
+        for (std::size_t i{}; i < x.size(); ++i) {
+            y[i] = impl::evaluate_polynomial<Scheme>(
+                impl::coefficients_as<T, coefficients>, x[i]);
+        }
+#endif
+    }
+};
+
+namespace impl {
+
+template<typename>
+inline constexpr bool is_static_polynomial{false};
+
+template<auto... C>
+inline constexpr bool is_static_polynomial<static_polynomial<C...>>{true};
+
+} // namespace impl
+
+} // namespace muc
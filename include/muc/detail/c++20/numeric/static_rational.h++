@@ -0,0 +1,134 @@
+// -*- C++ -*-
+//
+// Copyright (C) 2021-2026  Shihan Zhao
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "muc/detail/c++20/ceta_string/ceta_string.h++"
+#include "muc/detail/c++20/math/impl/simd_vector.h++"
+#include "muc/detail/c++20/numeric/static_polynomial.h++"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace muc {
+
+/// @brief A rational function with compile-time coefficients
+///
+/// `static_rational<static_polynomial<a...>, static_polynomial<b...>>`
+/// represents P(x) / Q(x). Both polynomials are evaluated with the same
+/// scheme, fully unrolled, and are independent of each other, so their
+/// dependency chains overlap. Batch evaluation is vectorized for the widest
+/// of SSE2/AVX2/AVX-512/NEON enabled at compile time.
+/// @note Division by zero is not checked.
+///
+/// @tparam P The numerator, a static_polynomial
+/// @tparam Q The denominator, a static_polynomial
+template<typename P, typename Q>
+    requires(impl::is_static_polynomial<P> and impl::is_static_polynomial<Q>)
+class static_rational {
+public:
+    using numerator = P;
+    using denominator = Q;
+
+public:
+    /// @brief Evaluate at x
+    /// @tparam Scheme "horner", "horner2" or "estrin"
+    template<ceta_string Scheme = "horner", std::floating_point T>
+        requires(Scheme == "horner" or Scheme == "horner2" or
+                 Scheme == "estrin")
+    static constexpr auto evaluate(T x) -> T {
+        return P::template evaluate<Scheme>(x) /
+               Q::template evaluate<Scheme>(x);
+    }
+
+    /// @brief Evaluate at a batch of x
+    /// @tparam Scheme "horner", "horner2" or "estrin"
+    /// @param x The values at which the function is to be evaluated
+    /// @param y Output values, of the same size as x. y may be x.
+    template<ceta_string Scheme = "horner">
+        requires(Scheme == "horner" or Scheme == "horner2" or
+                 Scheme == "estrin")
+    static auto evaluate(std::span<const double> x, std::span<double> y)
+        -> void {
+        evaluate_batch<Scheme, double>(x, y);
+    }
+
+    /// @brief Evaluate at a batch of x
+    /// @tparam Scheme "horner", "horner2" or "estrin"
+    /// @param x The values at which the function is to be evaluated
+    /// @param y Output values, of the same size as x. y may be x.
+    template<ceta_string Scheme = "horner">
+        requires(Scheme == "horner" or Scheme == "horner2" or
+                 Scheme == "estrin")
+    static auto evaluate(std::span<const float> x, std::span<float> y)
+        -> void {
+        evaluate_batch<Scheme, float>(x, y);
+    }
+
+    /// @brief Evaluate at x with the default scheme
+    template<std::floating_point T>
+    constexpr auto operator()(T x) const -> T {
+        return evaluate(x);
+    }
+
+    /// @brief Evaluate at x with the default scheme
+    template<std::floating_point T = double>
+    constexpr auto operator()(std::integral auto x) const -> T {
+        return evaluate(static_cast<T>(x));
+    }
+
+    /// @brief Evaluate at a batch of x with the default scheme
+    auto operator()(std::span<const double> x, std::span<double> y) const
+        -> void {
+        evaluate(x, y);
+    }
+
+    /// @brief Evaluate at a batch of x with the default scheme
+    auto operator()(std::span<const float> x, std::span<float> y) const
+        -> void {
+        evaluate(x, y);
+    }
+
+private:
+    template<ceta_string Scheme, typename T>
+    static auto evaluate_batch(std::span<const T> x, std::span<T> y) -> void {
+        assert(y.size() == x.size());
+        constexpr auto& p{impl::coefficients_as<T, P::coefficients>};
+        constexpr auto& q{impl::coefficients_as<T, Q::coefficients>};
+#if defined __GNUC__
+        impl::simd_transform<T, impl::simd_lanes<T>>(
+            x.data(), y.data(), x.size(), [](auto v) {
+                return impl::evaluate_polynomial<Scheme>(p, v) /
+                       impl::evaluate_polynomial<Scheme>(q, v);
+            });
+#else
+        for (std::size_t i{}; i < x.size(); ++i) {
+            y[i] = impl::evaluate_polynomial<Scheme>(p, x[i]) /
+                   impl::evaluate_polynomial<Scheme>(q, x[i]);
+        }
+#endif
+    }
+};
+
+} // namespace muc
@@ -5,6 +5,133 @@
 #include <iostream>
 #include <limits>
 
+#if __cplusplus >= 202002L
+#include "muc/chrono"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Drift time to radius inversion: solve t(r) = t_i for many hits. The
+// constants are float so that the functions also take vectors of float.
+constexpr auto drift_time{[](auto r, auto t) {
+    return r * (20 + r * (-1.5f + r * 0.4f)) - t;
+}};
+constexpr auto drift_time_derivative{[](auto r, auto) {
+    return 20 + r * (-3 + r * 1.2f);
+}};
+
+template<std::floating_point T, typename Scalar, typename Batch>
+auto compare(const char* name, std::size_t n, Scalar&& scalar, Batch&& batch)
+    -> bool {
+    std::vector<std::pair<T, bool>> expected(n);
+    muc::chrono::stopwatch sw;
+    for (std::size_t i{}; i < n; ++i) {
+        expected[i] = scalar(i);
+    }
+    const auto scalar_time{sw.read()};
+
+    std::vector<T> root(n);
+    const auto converged{std::make_unique<bool[]>(n)};
+    sw.reset();
+    batch(std::span{root}, std::span{converged.get(), n});
+    const auto batch_time{sw.read()};
+
+    auto ok{true};
+    for (std::size_t i{}; i < n; ++i) {
+        ok &= converged[i] == expected[i].second and
+              muc::abs(root[i] - expected[i].first) <=
+                  muc::tolerance<T>{}.at(root[i]);
+    }
+    std::cout << "  " << name << ": "
+              << static_cast<double>(scalar_time.count()) / n
+              << " ns (scalar loop), "
+              << static_cast<double>(batch_time.count()) / n
+              << " ns (batch)" << (ok ? "" : ", results differ!") << '\n';
+    return ok;
+}
+
+// Batch solvers against the scalar ones. With SSE2 only, double is solved
+// one by one while float (four lanes) runs in lockstep.
+template<std::floating_point T>
+auto drift_time_inversions(const char* type_name, std::size_t n) -> bool {
+    std::mt19937_64 rng{42};
+    std::uniform_real_distribution<T> radius{0, 5};
+    std::vector<T> t(n);
+    std::vector<T> guess(n);
+    for (std::size_t i{}; i < n; ++i) {
+        t[i] = drift_time(radius(rng), T{});
+        guess[i] = t[i] / 20;
+    }
+    const std::vector<T> lower(n, 0);
+    const std::vector<T> upper(n, 5.5);
+
+    std::cout << n << ' ' << type_name << " drift time inversions ("
+              << (muc::impl::solve_in_lockstep<T> ? "lockstep" : "one by one")
+              << "):\n";
+    auto ok{true};
+    ok &= compare<T>(
+        "newton", n,
+        [&](std::size_t i) {
+            return muc::find_root::newton(
+                [&](T r) { return drift_time(r, t[i]); },
+                [&](T r) { return drift_time_derivative(r, t[i]); },
+                guess[i]);
+        },
+        [&](std::span<T> root, std::span<bool> converged) {
+            std::ranges::copy(guess, root.begin());
+            muc::find_root::newton(drift_time, drift_time_derivative, root,
+                                   converged, t);
+        });
+    ok &= compare<T>(
+        "secant", n,
+        [&](std::size_t i) {
+            return muc::find_root::secant(
+                [&](T r) { return drift_time(r, t[i]); }, guess[i]);
+        },
+        [&](std::span<T> root, std::span<bool> converged) {
+            std::ranges::copy(guess, root.begin());
+            muc::find_root::secant(drift_time, root, converged, t);
+        });
+    ok &= compare<T>(
+        muc::impl::brent_in_lockstep<T> ? "brent" : "brent (one by one)", n,
+        [&](std::size_t i) {
+            return muc::find_root::brent(
+                [&](T r) { return drift_time(r, t[i]); }, lower[i],
+                upper[i]);
+        },
+        [&](std::span<T> root, std::span<bool> converged) {
+            muc::find_root::brent(drift_time, lower, upper, root, converged,
+                                  t);
+        });
+    ok &= compare<T>(
+        "itp", n,
+        [&](std::size_t i) {
+            return muc::find_root::itp(
+                [&](T r) { return drift_time(r, t[i]); }, lower[i],
+                upper[i]);
+        },
+        [&](std::span<T> root, std::span<bool> converged) {
+            muc::find_root::itp(drift_time, lower, upper, root, converged, t);
+        });
+    // Brackets without a sign change must be reported
+    std::vector<T> root(n);
+    const auto converged{std::make_unique<bool[]>(n)};
+    muc::find_root::brent(drift_time, upper, upper, std::span{root},
+                          std::span{converged.get(), n}, t);
+    for (std::size_t i{}; i < n; ++i) {
+        ok &= not converged[i];
+    }
+    return ok;
+}
+#endif
+
 #define MUC_TEST_NEWTON(f, df, x0)                                   \
     {                                                                \
         const auto [x, converged]{muc::find_root::newton(            \
@@ -41,6 +168,17 @@
                   << " (" << converged << ")\n";                           \
     }
 
+#define MUC_TEST_ITP(f, x1, x2)                                            \
+    {                                                                      \
+        const auto [x, converged]{muc::find_root::itp(                     \
+            [](auto x) {                                                   \
+                return f;                                                  \
+            },                                                             \
+            x1, x2)};                                                      \
+        std::cout << #f " = 0  (x1 = " #x1 ", x2 = " #x2 ") ->  x = " << x \
+                  << " (" << converged << ")\n";                           \
+    }
+
 auto main() -> int {
     std::cout << std::setprecision(std::numeric_limits<double>::max_digits10);
 
@@ -55,4 +193,16 @@ auto main() -> int {
     MUC_TEST_ZBRENT(std::log(x) - 1, 0.1, 0.5)
     MUC_TEST_ZBRENT(std::log(x) - 1, 0.1, 5.)
     MUC_TEST_ZBRENT(std::log(x) - 1, 0.1, 100.)
+
+    MUC_TEST_ITP(std::log(x) - 1, 0.1, 0.5)
+    MUC_TEST_ITP(std::log(x) - 1, 0.1, 5.)
+    MUC_TEST_ITP(std::log(x) - 1, 0.1, 100.)
+
+#if __cplusplus >= 202002L
+    constexpr std::size_t n{1'000'000};
+    auto ok{true};
+    ok &= drift_time_inversions<double>("double", n);
+    ok &= drift_time_inversions<float>("float", n);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+#endif
 }
@@ -0,0 +1,177 @@
+#include "muc/chrono"
+#include "muc/numeric"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <span>
+#include <vector>
+
+// Multilinear functions are reproduced exactly by multilinear interpolation
+constexpr auto multilinear{[](const auto& x) {
+    auto value{1.};
+    for (auto&& xi : x) {
+        value *= 1 + 0.5 * xi;
+    }
+    return value;
+}};
+
+// What users write without interp_table
+class naive_grid {
+public:
+    naive_grid(std::array<muc::interp_axis<double>, 3> axis, auto&& f) :
+        m_axis{std::move(axis)},
+        m_value(m_axis[0].size() * m_axis[1].size() * m_axis[2].size()) {
+        for (std::size_t i{}; i < m_axis[0].size(); ++i) {
+            for (std::size_t j{}; j < m_axis[1].size(); ++j) {
+                for (std::size_t k{}; k < m_axis[2].size(); ++k) {
+                    m_value[index(i, j, k)] = f(std::array{
+                        m_axis[0].knot(i), m_axis[1].knot(j),
+                        m_axis[2].knot(k)});
+                }
+            }
+        }
+    }
+
+    auto operator()(const std::array<double, 3>& x) const -> double {
+        const auto [i, u]{m_axis[0].locate(x[0])};
+        const auto [j, v]{m_axis[1].locate(x[1])};
+        const auto [k, w]{m_axis[2].locate(x[2])};
+        return muc::trilerp(
+            m_value[index(i, j, k)], m_value[index(i, j, k + 1)],
+            m_value[index(i, j + 1, k)], m_value[index(i, j + 1, k + 1)],
+            m_value[index(i + 1, j, k)], m_value[index(i + 1, j, k + 1)],
+            m_value[index(i + 1, j + 1, k)],
+            m_value[index(i + 1, j + 1, k + 1)], u, v, w);
+    }
+
+private:
+    auto index(std::size_t i, std::size_t j, std::size_t k) const
+        -> std::size_t {
+        return (i * m_axis[1].size() + j) * m_axis[2].size() + k;
+    }
+
+private:
+    std::array<muc::interp_axis<double>, 3> m_axis;
+    std::vector<double> m_value;
+};
+
+template<typename F>
+auto time(const char* name, std::size_t n, F&& f) -> double {
+    muc::chrono::stopwatch sw;
+    const auto sum{f()};
+    std::cout << name << ": " << static_cast<double>(sw.read().count()) / n
+              << " ns/lookup\n";
+    return sum;
+}
+
+auto main() -> int {
+    auto ok{true};
+    const auto close{[](double a, double b) {
+        return std::abs(a - b) <= 1e-12 * std::abs(b);
+    }};
+
+    // Small grids with a uniform and a non-uniform axis
+    const muc::interp_axis uniform{-1., 2., 11};
+    const muc::interp_axis non_uniform{std::vector{0., 0.1, 0.3, 0.35, 1., 1.8,
+                                                   2., 3.5, 3.6}};
+    const muc::interp_table<double, 1> table_1d{{non_uniform}, multilinear};
+    const muc::interp_table<double, 2> table_2d{{uniform, non_uniform},
+                                                multilinear};
+    const muc::interp_table<double, 3> table_3d{
+        {non_uniform, uniform, non_uniform}, multilinear};
+    std::mt19937_64 rng{42};
+    std::uniform_real_distribution<double> coordinate{-1.5, 4};
+    for (int n{}; n < 10000; ++n) {
+        const std::array x{coordinate(rng), coordinate(rng), coordinate(rng)};
+        ok &= close(table_1d(x[0]), multilinear(std::array{x[0]}));
+        ok &= close(table_2d(x[0], x[1]), multilinear(std::array{x[0], x[1]}));
+        ok &= close(table_3d(x), multilinear(x));
+    }
+    // at() returns the value of every knot
+    for (std::size_t i{}; i < non_uniform.size(); ++i) {
+        for (std::size_t j{}; j < uniform.size(); ++j) {
+            for (std::size_t k{}; k < non_uniform.size(); ++k) {
+                ok &= table_3d.at({i, j, k}) ==
+                      multilinear(std::array{non_uniform.knot(i),
+                                             uniform.knot(j),
+                                             non_uniform.knot(k)});
+            }
+        }
+    }
+    std::vector<double> row_major;
+    for (std::size_t i{}; i < uniform.size(); ++i) {
+        for (std::size_t j{}; j < non_uniform.size(); ++j) {
+            row_major.push_back(multilinear(
+                std::array{uniform.knot(i), non_uniform.knot(j)}));
+        }
+    }
+    const muc::interp_table<double, 2> from_values{{uniform, non_uniform},
+                                                   row_major};
+    for (int n{}; n < 1000; ++n) {
+        const auto x{coordinate(rng)};
+        const auto y{coordinate(rng)};
+        ok &= from_values(x, y) == table_2d(x, y);
+    }
+
+    // Field map sized well beyond the last level cache
+    constexpr std::size_t n_knot{160};
+    const std::array axis{muc::interp_axis{-1., 1., n_knot},
+                          muc::interp_axis{-1., 1., n_knot},
+                          muc::interp_axis{-1., 1., n_knot}};
+    const auto field{[](const auto& x) {
+        return std::sin(3 * x[0]) * std::cos(2 * x[1]) + x[2] * x[2];
+    }};
+    const naive_grid naive{axis, field};
+    const muc::interp_table<double, 3> table{axis, field};
+
+    constexpr std::size_t n_lookup{4'000'000};
+    std::uniform_real_distribution<double> inside{-1, 1};
+    std::vector<std::array<double, 3>> random(n_lookup);
+    for (auto&& x : random) {
+        x = {inside(rng), inside(rng), inside(rng)};
+    }
+    // Lookups along helices, like tracking a particle
+    std::vector<std::array<double, 3>> track(n_lookup);
+    for (std::size_t i{}; i < n_lookup; ++i) {
+        const auto phase{1e-3 * i};
+        track[i] = {0.9 * std::cos(phase), 0.9 * std::sin(phase),
+                    std::fmod(1e-5 * i, 2.) - 1};
+    }
+
+    std::vector<double> value(n_lookup);
+    for (auto&& [name, x] : {std::pair{"Random", &random},
+                             std::pair{"Track", &track}}) {
+        std::cout << name << " lookups:\n";
+        const auto expected{time("row-major grid", n_lookup, [&] {
+            auto sum{0.};
+            for (auto&& xi : *x) {
+                sum += naive(xi);
+            }
+            return sum;
+        })};
+        const auto scalar{time("muc::interp_table", n_lookup, [&] {
+            auto sum{0.};
+            for (auto&& xi : *x) {
+                sum += table(xi);
+            }
+            return sum;
+        })};
+        const auto batch{time("muc::interp_table (batch)", n_lookup, [&] {
+            table(*x, std::span{value});
+            auto sum{0.};
+            for (auto&& v : value) {
+                sum += v;
+            }
+            return sum;
+        })};
+        ok &= scalar == expected and batch == expected;
+    }
+
+    std::cout << (ok ? "Interpolation is consistent.\n" :
+                       "Interpolation mismatch!\n");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
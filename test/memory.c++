@@ -0,0 +1,250 @@
+#include "muc/chrono"
+#include "muc/memory"
+#include "muc/ptrvec"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+// Forwards to the default resource and counts the allocations
+class counting_resource : public std::pmr::memory_resource {
+public:
+    std::size_t n_allocations{};
+
+private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment)
+        -> void* override {
+        ++n_allocations;
+        return std::pmr::get_default_resource()->allocate(bytes, alignment);
+    }
+
+    auto do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+        -> void override {
+        std::pmr::get_default_resource()->deallocate(p, bytes, alignment);
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+        -> bool override {
+        return this == &other;
+    }
+};
+
+struct hit {
+    hit(int id, double t) :
+        id{id},
+        x{},
+        y{},
+        z{},
+        t{t} {}
+
+    int id;
+    double x;
+    double y;
+    double z;
+    double t;
+};
+
+constexpr int n_events{2000};
+
+// Random number of hits per event, same for all allocators
+auto make_event_sizes() -> std::vector<int> {
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> n_hits{0, 2000};
+    std::vector<int> sizes(n_events);
+    for (auto&& n : sizes) {
+        n = n_hits(rng);
+    }
+    return sizes;
+}
+
+// Fill and clear one container per event, timing both separately
+template<typename Vector, typename Make, typename Reset>
+auto run_events(const char* name, const std::vector<int>& sizes, Make&& make,
+                Reset&& reset) -> double {
+    std::chrono::nanoseconds fill_time{};
+    std::chrono::nanoseconds reset_time{};
+    long n_hits{};
+    double sum{};
+    Vector hits;
+    for (auto&& n : sizes) {
+        muc::chrono::stopwatch sw;
+        for (int i{}; i < n; ++i) {
+            hits.push_back(make(i, 0.5 * i));
+        }
+        fill_time += sw.read();
+        for (auto&& h : hits) {
+            sum += h->t;
+        }
+        n_hits += n;
+        sw.reset();
+        reset(hits);
+        reset_time += sw.read();
+    }
+    std::cout << name << ": "
+              << static_cast<double>(fill_time.count()) / n_hits
+              << " ns/alloc, "
+              << static_cast<double>(reset_time.count()) / n_events
+              << " ns/reset\n";
+    return sum;
+}
+
+// Allocate and free in random order to exercise the free list
+template<typename Alloc>
+auto churn(const char* name, Alloc&& alloc) -> void {
+    constexpr long n_ops{10'000'000};
+    // Random slots to free, or -1 to allocate, drawn beforehand
+    std::vector<int> ops(n_ops);
+    std::mt19937 rng{1};
+    for (long i{}, n_live{}; i < n_ops; ++i) {
+        if (n_live < 64 or (n_live < 4096 and rng() % 2)) {
+            ops[i] = -1;
+            ++n_live;
+        } else {
+            ops[i] = static_cast<int>(rng() % n_live--);
+        }
+    }
+    std::vector<hit*> live;
+    live.reserve(4096);
+    muc::chrono::stopwatch sw;
+    for (auto&& op : ops) {
+        if (op < 0) {
+            live.push_back(alloc.allocate(1));
+        } else {
+            alloc.deallocate(live[op], 1);
+            live[op] = live.back();
+            live.pop_back();
+        }
+    }
+    const auto elapsed{sw.read()};
+    for (auto&& p : live) {
+        alloc.deallocate(p, 1);
+    }
+    std::cout << name << ": " << static_cast<double>(elapsed.count()) / n_ops
+              << " ns/op\n";
+}
+
+auto main() -> int {
+    auto ok{true};
+    const auto sizes{make_event_sizes()};
+
+    std::cout << "Per-event objects:\n";
+    const auto expected{run_events<muc::unique_ptrvec<hit>>(
+        "std::allocator", sizes,
+        [](int id, double t) { return std::make_unique<hit>(id, t); },
+        [](auto& hits) { hits.clear(); })};
+
+    muc::object_pool<hit> pool;
+    ok &= expected == run_events<muc::pool_ptrvec<hit>>(
+                          "muc::object_pool", sizes,
+                          [&](int id, double t) {
+                              return muc::allocate_unique<hit>(std::ref(pool),
+                                                               id, t);
+                          },
+                          [](auto& hits) { hits.clear(); });
+
+    // No destructor to run, so the objects are dropped with the arena
+    muc::monotonic_arena arena;
+    ok &= expected == run_events<muc::raw_ptrvec<hit>>(
+                          "muc::monotonic_arena", sizes,
+                          [&](int id, double t) {
+                              return new (arena.allocate(sizeof(hit),
+                                                         alignof(hit)))
+                                  hit{id, t};
+                          },
+                          [&](auto& hits) {
+                              hits.clear();
+                              arena.reset();
+                          });
+    using arena_delete = muc::allocator_delete<hit, muc::arena_allocator<hit>>;
+    ok &= expected ==
+          run_events<muc::unique_ptrvec<hit, arena_delete>>(
+              "muc::arena_allocator", sizes,
+              [&](int id, double t) {
+                  return muc::allocate_unique<hit>(
+                      muc::arena_allocator<hit>{arena}, id, t);
+              },
+              [&](auto& hits) {
+                  hits.clear();
+                  arena.reset();
+              });
+
+    std::cout << "Allocate/free churn:\n";
+    churn("std::allocator", std::allocator<hit>{});
+    churn("muc::object_pool", muc::object_pool<hit>{});
+    churn("muc::object_pool (cross-thread)",
+          muc::object_pool<hit, true>{});
+
+    // Freed chunks are reused before new ones, and reset starts over
+    pool.reset();
+    const auto p{pool.allocate(1)};
+    pool.deallocate(p, 1);
+    ok &= pool.allocate(1) == p;
+    ok &= pool.allocate(1) != p;
+    pool.reset();
+    ok &= pool.allocate(1) == p;
+
+    // Alignment is honoured
+    for (std::size_t alignment{1}; alignment <= 4096; alignment *= 2) {
+        const auto q{arena.allocate(3, alignment)};
+        ok &= reinterpret_cast<std::uintptr_t>(q) % alignment == 0;
+    }
+    arena.reset();
+
+    // Chunks freed by other threads come back to the owner once its blocks
+    // are full
+    muc::object_pool<hit, true> shared_pool{100};
+    std::vector<hit*> chunks;
+    for (int i{}; i < 1000; ++i) {
+        chunks.push_back(shared_pool.allocate(1));
+    }
+    std::vector<std::thread> threads;
+    for (int t{}; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            for (auto i{t}; i < 1000; i += 4) {
+                shared_pool.deallocate(chunks[i], 1);
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    const std::set<hit*> freed(chunks.begin(), chunks.end());
+    for (int i{}; i < 1000; ++i) {
+        ok &= freed.count(shared_pool.allocate(1)) == 1;
+    }
+
+    // Memory resources
+    muc::pmr::arena_resource arena_resource{arena};
+    std::pmr::vector<double> v{&arena_resource};
+    for (int i{}; i < 10000; ++i) {
+        v.push_back(i);
+    }
+    ok &= v.back() == 9999;
+    // The node type of std::list is unspecified: size the chunks generously
+    // and check that no node had to go upstream, while larger requests do
+    counting_resource upstream;
+    muc::object_pool<std::array<std::byte, 64>> node_pool;
+    muc::pmr::pool_resource node_resource{node_pool, &upstream};
+    std::pmr::list<double> l{&node_resource};
+    for (int i{}; i < 10000; ++i) {
+        l.push_back(i);
+    }
+    ok &= l.back() == 9999 and l.size() == 10000;
+    ok &= upstream.n_allocations == 0;
+    std::pmr::vector<double> w(100, 0., &node_resource);
+    ok &= upstream.n_allocations == 1;
+
+    std::cout << (ok ? "All allocators are consistent.\n" :
+                       "Allocator mismatch!\n");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,156 @@
+#include "muc/chrono"
+#include "muc/mutex"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Contention benchmark: every thread repeatedly takes the lock to update a
+// shared counter, with a little private work between critical sections
+template<typename Mutex>
+auto contend(std::string_view name, unsigned n_threads, long n_ops) -> bool {
+    Mutex mutex;
+    long counter{};
+
+    muc::chrono::stopwatch sw;
+    std::vector<std::thread> threads;
+    for (unsigned t{}; t < n_threads; ++t) {
+        threads.emplace_back([&] {
+            volatile long work{};
+            for (long i{}; i < n_ops; ++i) {
+                {
+                    std::lock_guard lock{mutex};
+                    ++counter;
+                }
+                for (int j{}; j < 16; ++j) {
+                    work = work + j;
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    const auto elapsed{sw.read()};
+
+    const auto total{static_cast<long>(n_threads) * n_ops};
+    std::cout << std::setw(24) << name << ": " << std::setw(8)
+              << static_cast<double>(elapsed.count()) / total << " ns/op\n";
+    return counter == total;
+}
+
+// 1 write for 15 reads
+template<typename SharedMutex>
+auto contend_shared(std::string_view name, unsigned n_threads, long n_ops)
+    -> bool {
+    SharedMutex mutex;
+    long counter{};
+
+    muc::chrono::stopwatch sw;
+    std::vector<std::thread> threads;
+    for (unsigned t{}; t < n_threads; ++t) {
+        threads.emplace_back([&] {
+            [[maybe_unused]] volatile long observed{};
+            for (long i{}; i < n_ops; ++i) {
+                if (i % 16 == 0) {
+                    std::lock_guard lock{mutex};
+                    ++counter;
+                } else {
+                    std::shared_lock lock{mutex};
+                    observed = counter;
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    const auto elapsed{sw.read()};
+
+    const auto total{static_cast<long>(n_threads) * n_ops};
+    std::cout << std::setw(24) << name << ": " << std::setw(8)
+              << static_cast<double>(elapsed.count()) / total << " ns/op\n";
+    return counter == n_threads * ((n_ops + 15) / 16);
+}
+
+// Short-lived threads mixing try_lock and lock, so that queue nodes are
+// freed by exiting threads while others still use the mutex
+template<typename Mutex>
+auto churn_threads(std::string_view name, unsigned n_threads, int n_rounds)
+    -> bool {
+    Mutex mutex;
+    long counter{};
+    long expected{};
+
+    muc::chrono::stopwatch sw;
+    for (int round{}; round < n_rounds; ++round) {
+        std::vector<std::thread> threads;
+        std::vector<long> n_locked(n_threads);
+        for (unsigned t{}; t < n_threads; ++t) {
+            threads.emplace_back([&, t] {
+                for (int i{}; i < 256; ++i) {
+                    if (i % 16 == 0) {
+                        std::lock_guard lock{mutex};
+                        ++counter;
+                        ++n_locked[t];
+                    } else if (mutex.try_lock()) {
+                        ++counter;
+                        ++n_locked[t];
+                        mutex.unlock();
+                    }
+                }
+            });
+        }
+        for (auto&& thread : threads) {
+            thread.join();
+        }
+        for (auto&& n : n_locked) {
+            expected += n;
+        }
+    }
+    const auto elapsed{sw.read()};
+
+    std::cout << std::setw(24) << name << ": " << std::setw(8)
+              << static_cast<double>(elapsed.count()) / 1e6 << " ms\n";
+    return counter == expected;
+}
+
+auto main(int argc, char* argv[]) -> int {
+    const auto n_threads{argc > 1 ? static_cast<unsigned>(std::atoi(argv[1])) :
+                                    std::thread::hardware_concurrency()};
+    const long n_ops{argc > 2 ? std::atol(argv[2]) : 200'000};
+    std::cout << n_threads << " threads, " << n_ops << " locks per thread\n";
+
+    auto ok{true};
+    ok &= contend<std::mutex>("std::mutex", n_threads, n_ops);
+    ok &= contend<muc::spin_mutex>("muc::spin_mutex", n_threads, n_ops);
+    ok &= contend<muc::backoff_spin_mutex>("muc::backoff_spin_mutex",
+                                           n_threads, n_ops);
+    ok &= contend<muc::ticket_spin_mutex>("muc::ticket_spin_mutex", n_threads,
+                                          n_ops);
+    ok &= contend<muc::clh_spin_mutex>("muc::clh_spin_mutex", n_threads, n_ops);
+    ok &= contend<muc::shared_spin_mutex>("muc::shared_spin_mutex", n_threads,
+                                          n_ops);
+
+    std::cout << "Read-mostly:\n";
+    ok &= contend_shared<std::shared_mutex>("std::shared_mutex", n_threads,
+                                            n_ops);
+    ok &= contend_shared<muc::shared_spin_mutex>("muc::shared_spin_mutex",
+                                                 n_threads, n_ops);
+
+    std::cout << "Short-lived threads:\n";
+    const auto n_churn{std::max(n_threads, 4u)};
+    ok &= churn_threads<muc::spin_mutex>("muc::spin_mutex", n_churn, 200);
+    ok &= churn_threads<muc::clh_spin_mutex>("muc::clh_spin_mutex", n_churn,
+                                             200);
+
+    std::cout << (ok ? "All counters are consistent.\n" :
+                       "Counter mismatch!\n");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
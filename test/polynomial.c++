@@ -0,0 +1,162 @@
+#include "muc/chrono"
+#include "muc/numeric"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Degree-12 fit, as in our calibration maps
+constexpr std::array coefficients{
+    0.9998, -0.2103, 0.0412, -0.0067, 9.1e-4,  -1.04e-4, 1.0e-5,
+    -8.2e-7, 5.6e-8,  -3.2e-9, 1.5e-10, -5.4e-12, 1.3e-13};
+constexpr std::array denominator{1., 0.05, 0.002};
+using fit = muc::static_polynomial<coefficients>;
+using fit_rational =
+    muc::static_rational<fit, muc::static_polynomial<denominator>>;
+
+static_assert(fit::degree == 12);
+static_assert(muc::static_polynomial<1, 2, 3>{}(2) == 17);
+static_assert(muc::static_polynomial<1., 2., 3.>::evaluate<"horner">(2.) == 17);
+static_assert(muc::static_polynomial<1., 2., 3.>::evaluate<"horner2">(2.) ==
+              17);
+static_assert(muc::static_polynomial<1., 2., 3.>::evaluate<"estrin">(2.) ==
+              17);
+static_assert(muc::static_polynomial<5.>{}(2.) == 5);
+static_assert(muc::polynomial<"estrin">(std::array{1, 2, 3, 4, 5}, 2.) ==
+              129);
+
+auto reference(long double x) -> long double {
+    long double p{};
+    for (auto c{coefficients.rbegin()}; c != coefficients.rend(); ++c) {
+        p = p * x + *c;
+    }
+    return p;
+}
+
+// Latency: each evaluation depends on the previous one
+template<typename F>
+auto time_chain(const char* name, F&& p) -> void {
+    constexpr long n{10'000'000};
+    muc::chrono::stopwatch sw;
+    double t{0.5};
+    for (long i{}; i < n; ++i) {
+        t = p(t) * 1e-3 + 0.5;
+    }
+    const auto elapsed{sw.read()};
+    [[maybe_unused]] volatile auto sink{t};
+    std::cout << "  " << name << ": "
+              << elapsed.count() / static_cast<double>(n) << " ns\n";
+}
+
+// Throughput: independent evaluations over a batch
+template<typename F>
+auto time_batch(const char* name, std::size_t size, F&& f) -> void {
+    constexpr auto n_repeat{200};
+    muc::chrono::stopwatch sw;
+    for (int r{}; r < n_repeat; ++r) {
+        f();
+    }
+    const auto elapsed{sw.read()};
+    std::cout << "  " << name << ": "
+              << elapsed.count() / static_cast<double>(n_repeat * size)
+              << " ns\n";
+}
+
+auto main() -> int {
+    std::mt19937_64 rng{42};
+    std::uniform_real_distribution<double> u{0, 10};
+    std::vector<double> x(1 << 16);
+    for (auto&& xi : x) {
+        xi = u(rng);
+    }
+
+    auto ok{true};
+    // Schemes agree with an extended precision reference
+    auto max_error{0.};
+    for (auto xi : x) {
+        const auto expected{static_cast<double>(reference(xi))};
+        for (const auto p : {fit::evaluate<"horner">(xi),
+                             fit::evaluate<"horner2">(xi),
+                             fit::evaluate<"estrin">(xi),
+                             muc::polynomial<"estrin">(coefficients, xi)}) {
+            max_error = std::max(max_error,
+                                 std::abs(p - expected) / std::abs(expected));
+        }
+    }
+    std::cout << "Max relative error of the schemes: " << max_error << '\n';
+    ok &= max_error < 1e-13;
+
+    // Batches agree with the scalar functions, also with the default schemes
+    std::vector<double> y(x.size());
+    muc::polynomial(coefficients, x, y);
+    for (std::size_t i{}; i < x.size(); ++i) {
+        ok &= y[i] == muc::polynomial(coefficients, x[i]);
+    }
+    muc::rational(coefficients, denominator, x, y);
+    for (std::size_t i{}; i < x.size(); ++i) {
+        ok &= y[i] == muc::rational(coefficients, denominator, x[i]);
+    }
+    fit::evaluate<"estrin">(x, y);
+    for (std::size_t i{}; i < x.size(); ++i) {
+        ok &= y[i] == fit::evaluate<"estrin">(x[i]);
+    }
+    fit_rational{}(x, y);
+    for (std::size_t i{}; i < x.size(); ++i) {
+        ok &= y[i] == fit_rational{}(x[i]);
+    }
+    std::vector<float> xf(x.begin(), x.end());
+    std::vector<float> yf(xf.size());
+    fit{}(xf, yf);
+    for (std::size_t i{}; i < xf.size(); ++i) {
+        ok &= yf[i] == fit{}(xf[i]);
+    }
+    // Double coefficients over float values: accumulated in double as well
+    muc::polynomial(coefficients, xf, yf);
+    for (std::size_t i{}; i < xf.size(); ++i) {
+        ok &= yf[i] == muc::polynomial(coefficients, xf[i]);
+    }
+    muc::rational(coefficients, denominator, xf, yf);
+    for (std::size_t i{}; i < xf.size(); ++i) {
+        ok &= yf[i] == muc::rational(coefficients, denominator, xf[i]);
+    }
+
+    std::cout << "Dependent evaluations:\n";
+    time_chain("muc::polynomial",
+               [](double t) { return muc::polynomial(coefficients, t); });
+    time_chain("horner", [](double t) { return fit::evaluate<"horner">(t); });
+    time_chain("horner2",
+               [](double t) { return fit::evaluate<"horner2">(t); });
+    time_chain("estrin", [](double t) { return fit::evaluate<"estrin">(t); });
+
+    std::cout << "Batch evaluations:\n";
+    time_batch("muc::polynomial loop", x.size(), [&] {
+        for (std::size_t i{}; i < x.size(); ++i) {
+            y[i] = muc::polynomial(coefficients, x[i]);
+        }
+    });
+    time_batch("muc::polynomial span", x.size(),
+               [&] { muc::polynomial(coefficients, x, y); });
+    // Coefficients known only at run time, e.g. loaded from a calibration file
+    const std::vector<double> loaded(coefficients.begin(), coefficients.end());
+    time_batch("muc::polynomial loop (run-time coefficients)", x.size(), [&] {
+        for (std::size_t i{}; i < x.size(); ++i) {
+            y[i] = muc::polynomial(loaded, x[i]);
+        }
+    });
+    time_batch("muc::polynomial span (run-time coefficients)", x.size(),
+               [&] { muc::polynomial(loaded, x, y); });
+    time_batch("horner span", x.size(),
+               [&] { fit::evaluate<"horner">(x, y); });
+    time_batch("horner2 span", x.size(),
+               [&] { fit::evaluate<"horner2">(x, y); });
+    time_batch("estrin span", x.size(),
+               [&] { fit::evaluate<"estrin">(x, y); });
+    time_batch("rational span", x.size(), [&] { fit_rational{}(x, y); });
+
+    std::cout << (ok ? "Results are consistent.\n" : "Results differ!\n");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
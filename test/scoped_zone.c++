@@ -0,0 +1,112 @@
+#include "muc/chrono"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+constexpr long n_iterations{10'000'000};
+
+auto empty_loop() -> std::chrono::nanoseconds {
+    muc::chrono::stopwatch sw;
+    for (long i{}; i < n_iterations; ++i) {
+        std::atomic_signal_fence(std::memory_order::seq_cst);
+    }
+    return sw.read();
+}
+
+template<muc::ceta_string Name, typename Stopwatch>
+auto zone_loop() -> std::chrono::nanoseconds {
+    muc::chrono::stopwatch sw;
+    for (long i{}; i < n_iterations; ++i) {
+        const muc::chrono::scoped_zone<Name, Stopwatch> zone;
+        std::atomic_signal_fence(std::memory_order::seq_cst);
+    }
+    return sw.read();
+}
+
+// The two stopwatch reads of a zone, without the zone
+template<typename Stopwatch>
+auto stopwatch_loop() -> std::chrono::nanoseconds {
+    muc::chrono::stopwatch sw;
+    for (long i{}; i < n_iterations; ++i) {
+        const Stopwatch inner;
+        std::atomic_signal_fence(std::memory_order::seq_cst);
+        [[maybe_unused]] volatile auto t{inner.read().count()};
+    }
+    return sw.read();
+}
+
+// Per-zone overhead: time of a loop of empty zones minus time of an empty
+// loop, next to the cost of starting and reading the stopwatch alone
+template<muc::ceta_string Name, typename Stopwatch>
+auto print_overhead() -> void {
+    const auto per_iteration{[baseline = empty_loop()](auto elapsed) {
+        return static_cast<double>((elapsed - baseline).count()) /
+               n_iterations;
+    }};
+    const auto zone{per_iteration(zone_loop<Name, Stopwatch>())};
+    const auto reads{per_iteration(stopwatch_loop<Stopwatch>())};
+    std::cout << Name.sv() << ": " << zone << " ns per zone, " << reads
+              << " ns to start and read the stopwatch\n";
+}
+
+auto work(int n) -> void {
+    MUC_SCOPED_ZONE("work");
+    for (int i{}; i < n; ++i) {
+        MUC_SCOPED_ZONE("work/step");
+        volatile double x{1};
+        for (int j{}; j < 100 * (i % 7 + 1); ++j) {
+            x = x * 1.0000001;
+        }
+    }
+}
+
+auto main() -> int {
+#ifndef MUC_DISABLE_SCOPED_ZONE
+    std::cout << "Overhead:\n";
+#else
+    std::cout << "Overhead with MUC_DISABLE_SCOPED_ZONE:\n";
+#endif
+    print_overhead<"overhead/tsc_stopwatch", muc::chrono::tsc_stopwatch>();
+    print_overhead<"overhead/serializing_tsc_stopwatch",
+                   muc::chrono::serializing_tsc_stopwatch>();
+    print_overhead<"overhead/stopwatch", muc::chrono::stopwatch>();
+    print_overhead<"overhead/thread_stopwatch",
+                   muc::chrono::thread_stopwatch>();
+
+    constexpr auto n_threads{4};
+    constexpr auto n_steps{10'000};
+    std::vector<std::thread> threads;
+    for (int t{}; t < n_threads; ++t) {
+        threads.emplace_back(work, n_steps);
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    work(n_steps);
+
+    const auto& registry{muc::chrono::zone_registry::instance()};
+    std::cout << "\nText report:\n";
+    registry.write_text(std::cout);
+    std::cout << "\nCSV report:\n";
+    registry.write_csv(std::cout);
+    std::cout << "\nJSON report:\n";
+    registry.write_json(std::cout);
+
+#ifndef MUC_DISABLE_SCOPED_ZONE
+    for (auto&& zone : registry.collect()) {
+        if (zone.name == "work/step" and
+            zone.count != (n_threads + 1) * n_steps) {
+            std::cout << "Zone count mismatch!\n";
+            return EXIT_FAILURE;
+        }
+    }
+#else
+    if (not registry.collect().empty()) {
+        std::cout << "Disabled zones were recorded!\n";
+        return EXIT_FAILURE;
+    }
+#endif
+}
@@ -0,0 +1,195 @@
+#include "muc/chrono"
+#include "muc/math"
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <numbers>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template<std::floating_point T>
+using bits_t = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+
+// Distance in ulp, counting across zero. NaN vs NaN is 0.
+template<std::floating_point T>
+auto ulp_distance(T a, T b) -> bits_t<T> {
+    if (std::isnan(a) and std::isnan(b)) {
+        return 0;
+    }
+    if (std::isnan(a) or std::isnan(b)) {
+        return std::numeric_limits<bits_t<T>>::max();
+    }
+    const auto key{[](T x) {
+        constexpr auto sign{bits_t<T>{1} << (8 * sizeof(T) - 1)};
+        const auto u{std::bit_cast<bits_t<T>>(x)};
+        return u & sign ? ~u : u | sign;
+    }};
+    const auto ka{key(a)};
+    const auto kb{key(b)};
+    return ka > kb ? ka - kb : kb - ka;
+}
+
+// Log-uniform magnitudes over the whole finite range, plus special values and
+// points close to multiples of pi/2
+template<std::floating_point T>
+auto full_range_sample(std::size_t n) -> std::vector<T> {
+    std::mt19937_64 rng{42};
+    std::uniform_int_distribution<int> exponent{
+        std::numeric_limits<T>::min_exponent -
+            std::numeric_limits<T>::digits,
+        std::numeric_limits<T>::max_exponent - 1};
+    std::uniform_real_distribution<T> mantissa{1, 2};
+    std::bernoulli_distribution negative{0.5};
+    std::vector<T> x{0,
+                     -T{0},
+                     std::numeric_limits<T>::denorm_min(),
+                     std::numeric_limits<T>::min(),
+                     std::numeric_limits<T>::max(),
+                     -std::numeric_limits<T>::max(),
+                     std::numeric_limits<T>::infinity(),
+                     -std::numeric_limits<T>::infinity(),
+                     std::numeric_limits<T>::quiet_NaN()};
+    for (int k{-1000}; k <= 1000; ++k) {
+        const auto y{static_cast<T>(k * std::numbers::pi / 2)};
+        x.insert(x.end(), {std::nextafter(y, T{-1e9}), y,
+                           std::nextafter(y, T{1e9})});
+    }
+    while (x.size() < n) {
+        const auto y{std::ldexp(mantissa(rng), exponent(rng))};
+        x.push_back(negative(rng) ? -y : y);
+    }
+    return x;
+}
+
+template<std::floating_point T>
+auto check_sincos(const char* name, bits_t<T> max_ulp) -> bool {
+    auto x{full_range_sample<T>(1 << 22)};
+    // Most inputs in the SIMD domain, as in practice
+    std::mt19937_64 rng{1};
+    std::uniform_real_distribution<T> angle{-1000, 1000};
+    for (std::size_t i{}; i < (1u << 22); ++i) {
+        x.push_back(angle(rng));
+    }
+    std::vector<T> s(x.size());
+    std::vector<T> c(x.size());
+    muc::sincos(x, s, c);
+
+    bits_t<T> max_s{};
+    bits_t<T> max_c{};
+    for (std::size_t i{}; i < x.size(); ++i) {
+        const auto [s0, c0]{muc::sincos(x[i])};
+        max_s = std::max(max_s, ulp_distance(s[i], s0));
+        max_c = std::max(max_c, ulp_distance(c[i], c0));
+    }
+    std::cout << name << ": max " << max_s << " ulp (sin), " << max_c
+              << " ulp (cos) over " << x.size() << " inputs\n";
+    return max_s <= max_ulp and max_c <= max_ulp;
+}
+
+template<std::floating_point T>
+auto check_pow(const char* name) -> bool {
+    std::mt19937_64 rng{2};
+    std::uniform_real_distribution<T> log_x{-8, 8};
+    std::vector<T> x(100'003);
+    for (auto&& xi : x) {
+        xi = std::exp(log_x(rng));
+    }
+    std::vector<T> y(x.size());
+    bits_t<T> max_ulp{};
+    for (int n{-70}; n <= 70; ++n) {
+        muc::pow(x, n, y);
+        for (std::size_t i{}; i < x.size(); ++i) {
+            max_ulp = std::max(max_ulp, ulp_distance(y[i], muc::pow(x[i], n)));
+        }
+    }
+    std::cout << name << ": max " << max_ulp << " ulp\n";
+    return max_ulp == 0;
+}
+
+constexpr std::size_t n_repeat{20};
+
+// Average ns per element over n_repeat runs of f. Every output of every run
+// is summed into the checksum, outside the timed region, so that the
+// compiler can drop none of the work.
+template<typename F, typename... Out>
+auto timed(std::size_t n, F&& f, const Out&... out)
+    -> std::pair<double, double> {
+    muc::chrono::stopwatch::duration elapsed{};
+    double checksum{};
+    for (std::size_t r{}; r < n_repeat; ++r) {
+        muc::chrono::stopwatch sw;
+        f();
+        elapsed += sw.read();
+        ((checksum = std::accumulate(out.begin(), out.end(), checksum)), ...);
+    }
+    [[maybe_unused]] volatile double sink{checksum};
+    return {static_cast<double>(elapsed.count()) / (n_repeat * n), checksum};
+}
+
+template<std::floating_point T>
+auto benchmark(const char* name) -> bool {
+    std::mt19937_64 rng{3};
+    std::uniform_real_distribution<T> angle{-4, 4};
+    std::vector<T> x(1 << 20);
+    for (auto&& xi : x) {
+        xi = angle(rng);
+    }
+    std::vector<T> s(x.size());
+    std::vector<T> c(x.size());
+
+    const auto [scalar_sincos, scalar_sincos_sum]{timed(
+        x.size(),
+        [&] {
+            for (std::size_t i{}; i < x.size(); ++i) {
+                const auto [si, ci]{muc::sincos(x[i])};
+                s[i] = si;
+                c[i] = ci;
+            }
+        },
+        s, c)};
+    const auto [span_sincos, span_sincos_sum]{
+        timed(x.size(), [&] { muc::sincos(x, s, c); }, s, c)};
+
+    const auto [scalar_pow, scalar_pow_sum]{timed(
+        x.size(),
+        [&] {
+            for (std::size_t i{}; i < x.size(); ++i) {
+                s[i] = muc::pow(x[i], 7);
+            }
+        },
+        s)};
+    const auto [span_pow, span_pow_sum]{
+        timed(x.size(), [&] { muc::pow(x, 7, s); }, s)};
+
+    std::cout << name << " sincos: " << scalar_sincos << " ns (scalar), "
+              << span_sincos << " ns (span)\n"
+              << name << " pow(x, 7): " << scalar_pow << " ns (scalar), "
+              << span_pow << " ns (span)\n";
+    // sincos may differ by 1 ulp (at most epsilon, as |sin|, |cos| <= 1) per
+    // output, pow is exact
+    const auto sincos_tolerance{static_cast<double>(2 * n_repeat * x.size()) *
+                                std::numeric_limits<T>::epsilon()};
+    return std::abs(scalar_sincos_sum - span_sincos_sum) <= sincos_tolerance and
+           scalar_pow_sum == span_pow_sum;
+}
+
+auto main() -> int {
+    std::cout << muc::impl::simd_bytes << "-byte vectors\n";
+    auto ok{true};
+    ok &= check_sincos<double>("double sincos", 1);
+    ok &= check_sincos<float>("float sincos", 1);
+    ok &= check_pow<double>("double pow");
+    ok &= check_pow<float>("float pow");
+    ok &= benchmark<double>("double");
+    ok &= benchmark<float>("float");
+    std::cout << (ok ? "Errors are within bounds.\n" : "Error bound exceeded!\n");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
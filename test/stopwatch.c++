@@ -1,5 +1,6 @@
 #include "muc/chrono"
 
+#include <cstdlib>
 #include <iostream>
 #include <random>
 #include <thread>
@@ -13,6 +14,18 @@ auto task() -> void {
     std::cout << "Done (" << result << ").\n";
 }
 
+template<typename Stopwatch>
+auto read_overhead() -> double {
+    constexpr auto n{1'000'000};
+    Stopwatch sw;
+    [[maybe_unused]] volatile typename Stopwatch::duration::rep sink;
+    muc::chrono::stopwatch total;
+    for (int i{}; i < n; ++i) {
+        sink = sw.read().count();
+    }
+    return static_cast<double>(total.read().count()) / n;
+}
+
 auto main() -> int {
     using namespace std::chrono_literals;
 
@@ -42,4 +55,46 @@ auto main() -> int {
         task();
         std::cout << "CPU time used: " << psw.read().count() << " ns\n";
     }
+    {
+        muc::chrono::stopwatch sw;
+        muc::chrono::tsc_stopwatch tsw;
+        muc::chrono::serializing_tsc_stopwatch ssw;
+        std::cout << "TSC stopwatch "
+                  << (tsw.uses_tsc() ? "uses the TSC.\n" :
+                                       "falls back to stopwatch.\n");
+
+        std::cout << "Sleep 200 ms.\n";
+        sw.reset();
+        tsw.reset();
+        ssw.reset();
+        std::this_thread::sleep_for(200ms);
+        const auto t{sw.read()};
+        const auto tsc_t{tsw.read()};
+        const auto serializing_tsc_t{ssw.read()};
+        std::cout << "Wall time elapsed: " << t.count() << " ns (stopwatch), "
+                  << tsc_t.count() << " ns (tsc_stopwatch), "
+                  << serializing_tsc_t.count()
+                  << " ns (serializing_tsc_stopwatch)\n";
+
+        std::cout << "Read overhead: "
+                  << read_overhead<muc::chrono::stopwatch>()
+                  << " ns (stopwatch), "
+                  << read_overhead<muc::chrono::tsc_stopwatch>()
+                  << " ns (tsc_stopwatch), "
+                  << read_overhead<muc::chrono::serializing_tsc_stopwatch>()
+                  << " ns (serializing_tsc_stopwatch)\n";
+
+        // The calibration error grows with the elapsed time, allow a few
+        // times its estimate, plus the time between consecutive reads
+        const auto relative_error{
+            muc::chrono::impl::tsc_calibration::get().relative_error()};
+        std::cout << "TSC calibration relative error: " << relative_error
+                  << '\n';
+        const auto tolerance{4 * relative_error * t.count() + 100'000};
+        if (std::abs(tsc_t.count() - t.count()) > tolerance or
+            std::abs(serializing_tsc_t.count() - t.count()) > tolerance) {
+            std::cout << "TSC stopwatch disagrees with stopwatch!\n";
+            return EXIT_FAILURE;
+        }
+    }
 }
@@ -0,0 +1,123 @@
+#include "muc/algorithm"
+#include "muc/chrono"
+
+#include <algorithm>
+#include <cstdlib>
+#include <execution>
+#include <iostream>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct record {
+    int key;
+    int index;
+
+    auto operator==(const record&) const -> bool = default;
+};
+
+// Sorted blocks of random length with some noise, like our event tables
+auto make_partially_sorted(std::size_t n) -> std::vector<record> {
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> block_length{1, 4096};
+    std::uniform_int_distribution<int> key{0, 1 << 20};
+    std::bernoulli_distribution noise{0.01};
+
+    std::vector<record> data;
+    data.reserve(n);
+    while (data.size() < n) {
+        const auto length{
+            std::min<std::size_t>(block_length(rng), n - data.size())};
+        auto k{key(rng)};
+        for (std::size_t i{}; i < length; ++i) {
+            k += noise(rng) ? -key(rng) % 64 : key(rng) % 4;
+            data.push_back({k, static_cast<int>(data.size())});
+        }
+    }
+    return data;
+}
+
+template<typename F>
+auto time(const char* name, std::vector<record> data, F&& sort)
+    -> std::vector<record> {
+    muc::chrono::stopwatch sw;
+    sort(data);
+    const auto elapsed{sw.read()};
+    std::cout << name << ": " << elapsed.count() / 1e6 << " ms\n";
+    return data;
+}
+
+auto main(int argc, char* argv[]) -> int {
+    const std::size_t n{argc > 1 ? std::strtoull(argv[1], nullptr, 10) :
+                                   (1ull << 23)};
+    std::cout << n << " records, " << std::thread::hardware_concurrency()
+              << " threads\n";
+
+    const auto data{make_partially_sorted(n)};
+    constexpr auto key{&record::key};
+
+    const auto expected{time("std::stable_sort(par)", data, [&](auto& v) {
+        std::stable_sort(std::execution::par, v.begin(), v.end(),
+                         [](auto&& a, auto&& b) { return a.key < b.key; });
+    })};
+    const auto serial{time("muc::timsort", data, [&](auto& v) {
+        muc::timsort(v, {}, key);
+    })};
+    const auto parallel{time("muc::timsort(par)", data, [&](auto& v) {
+        muc::timsort(std::execution::par, v, {}, key);
+    })};
+
+    // Thread count sweep, through the implementation as the parallel policy
+    // always uses std::thread::hardware_concurrency() threads
+    auto sweep_ok{true};
+    for (const int n_threads : {1, 2, 4, 8, 16}) {
+        const auto name{"muc::timsort(" + std::to_string(n_threads) +
+                        " threads)"};
+        using iterator = std::vector<record>::iterator;
+        const auto sorted{time(name.c_str(), data, [&](auto& v) {
+            muc::detail::ParallelTimSort<iterator>::sort(
+                v.begin(), v.end(), n_threads, std::ranges::less{}, key);
+        })};
+        sweep_ok &= sorted == expected;
+    }
+
+    auto halves{data};
+    const auto middle{halves.begin() + halves.size() / 3};
+    muc::timsort(halves.begin(), middle, {}, key);
+    muc::timsort(middle, halves.end(), {}, key);
+    const auto merged{time("muc::timmerge(par)", halves, [&](auto& v) {
+        muc::timmerge(std::execution::par, v,
+                      v.begin() + (middle - halves.begin()), {}, key);
+    })};
+
+    // Many small per-event hit lists in a CSR layout, sorted with one
+    // workspace, against one std::stable_sort per row
+    std::vector<std::size_t> offsets{0};
+    for (std::mt19937 rng{1}; offsets.back() < n;) {
+        offsets.push_back(
+            std::min<std::size_t>(offsets.back() + rng() % 256, n));
+    }
+    auto rows_expected{data};
+    for (std::size_t i{1}; i < offsets.size(); ++i) {
+        std::stable_sort(rows_expected.begin() + offsets[i - 1],
+                         rows_expected.begin() + offsets[i],
+                         [](auto&& a, auto&& b) { return a.key < b.key; });
+    }
+    std::byte arena[1 << 16];
+    std::pmr::monotonic_buffer_resource resource{arena, sizeof arena};
+    muc::pmr::timsort_workspace<record> workspace{&resource};
+    workspace.reserve(256);
+    const auto rows{time("muc::timsort_batch", data, [&](auto& v) {
+        muc::timsort_batch(v, offsets, workspace, {}, key);
+    })};
+
+    const auto ok{serial == expected and parallel == expected and sweep_ok and
+                  merged == expected and rows == rows_expected};
+    std::cout << (ok ? "Results are identical and stable.\n" :
+                       "Results differ!\n");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}